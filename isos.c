@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -29,242 +29,637 @@
 
   isos.c, isos.h
   - The main files of the ISOS
-  - Provide all internal variables used in the ISOS (main clock, scheduler period, task/resource task/due lists, etc)
+  - Provide the kernel context (IsosKernel) holding all the state of one OS instance (main clock, scheduler period, task/resource task/due lists, etc)
   - Provide all major OS related functions (task registration, scheduler, task execution, OS running, clock ticking, etc)
+    on a given kernel (IsosKernel_ functions), so that several kernels can run in parallel
   - Provide supporting functions to use in the task implementation (get main clock time, get task flags, claim/release resources, etc)
+  - Provide the Isos_ functions working on the current kernel of the thread (the default kernel unless changed)
 */
 
 #include <stdio.h>
 #include <string.h>
 #include "isos.h"
-#include "isos_quicksort.h"
+#if ISOS_PARALLEL_EXECUTOR
+#include "isos_executor.h"
+#endif // ISOS_PARALLEL_EXECUTOR
 
-#define BASIC_DEBUG 1
+#ifndef BASIC_DEBUG
+#define BASIC_DEBUG 1 //may be set from the build (i.e. to 0 by the Benchmark build target)
+#endif // BASIC_DEBUG
 
 #if BASIC_DEBUG
 #include "isos_debug_basic.h"
 #endif // BASIC_DEBUG
 
-//All the variable belows shouldn't be used anywhere else, therefore statics, thus cannot be "extern"-ed
-static IsosClock IsosMainClock; //The main clock used for the whole project
-static IsosClock LastSchedulerRun; //used to track when the last time the scheduler run
-static IsosClock LastSchedulerFinished; //unused in the program actually, probably good for debugging
-static IsosClock SchedulerPeriod; //used to calculate when the next time the scheduler should be run again
-static IsosTask IsosTaskList[MAX_TASK_SIZE];
-static IsosDueTask IsosDueTaskList[MAX_TASK_SIZE]; //an array, as required by the QuickSort
-static unsigned char IsosResourceTaskList[RESOURCE_SIZE]; //to store the mapping of the resource type to the task Id
-static char IsosResourceTaskClaimerList[RESOURCE_SIZE]; //to store the current claimer(s) of the resource tasks
-static IsosBuffer IsosResourceTaskBufferList[RESOURCE_SIZE * 2]; //to store the mapping of the buffered resource type to the task Id
-static short IsosDueTaskSize = 0;
-static short IsosTaskSize = 0;
-static char IsosRequestSorting = 0; //a flag to request sorting in the scheduler
-static IsosResourceTaskType LastClaimedResourceTask = IsosResourceTaskType_Unspecified; //Used as a flag if there is any resource task that has just been claimed
-static IsosResourceTaskType LastReleasedResourceTask = IsosResourceTaskType_Unspecified; //Used as a flag if there is any resource task that has just been released
+#if ISOS_TRACE
+#define ISOS_TRACE_RECORD(kernel, type, taskId, detail, value) \
+  do { if ((kernel)->Trace) IsosTrace_Record((kernel)->Trace, IsosClock_ToMs(&(kernel)->MainClock), (type), (taskId), (unsigned char)(detail), (int)(value)); } while (0)
+#else
+#define ISOS_TRACE_RECORD(kernel, type, taskId, detail, value)
+#endif // ISOS_TRACE
+
+#if ISOS_TRACE_RING
+//The category is a constant, so the whole event is left out by the compiler when its category is not in ISOS_TRACE_RING_CATEGORIES
+#define ISOS_TRACE_RING_PUT(kernel, category, type, taskId, detail, value) \
+  do { if (((category) & ISOS_TRACE_RING_CATEGORIES) && (kernel)->TraceRing) \
+         IsosTraceRing_Put((kernel)->TraceRing, IsosClock_ToMs(&(kernel)->MainClock), (type), (taskId), (unsigned char)(detail), (int)(value)); } while (0)
+#else
+#define ISOS_TRACE_RING_PUT(kernel, category, type, taskId, detail, value)
+#endif // ISOS_TRACE_RING
+
+//The scheduling decisions go to both the trace (to be replayed) and the trace ring (to be looked at)
+#define ISOS_TRACE_EVENT(kernel, category, type, taskId, detail, value) \
+  do { ISOS_TRACE_RECORD(kernel, type, taskId, detail, value); ISOS_TRACE_RING_PUT(kernel, category, type, taskId, detail, value); } while (0)
+
+//The kernel state lives in IsosKernel, the variables below are only to provide the default kernel used by the Isos_ functions
+static long long IsosDefaultArena[(ISOS_ARENA_SIZE(MAX_TASK_SIZE, MAX_RESOURCE_SIZE, MAX_EVENT_GROUP_SIZE, MAX_MAILBOX_SIZE) + ISOS_ARENA_ALIGNMENT - 1) / ISOS_ARENA_ALIGNMENT]; //used by Isos_Init
+static IsosKernel IsosDefaultKernel;
+static ISOS_THREAD_LOCAL IsosKernel* IsosCurrentKernel = &IsosDefaultKernel; //the kernel used by the Isos_ functions on this thread
+static ISOS_THREAD_LOCAL IsosKernel* IsosWorkerKernel = (void*)0; //the kernel whose parallel-safe task actions this thread is running, which it may not change then
 static unsigned char NullBuffer[0]; //Used for resource tasks with no buffer
 
-//Since it is so common to have these variables, we my as well initialize them outside of functions
-// to save some initialization of variables across different functions
-static IsosTask* genericTask;
-static IsosTaskInfo* genericTaskInfo;
-static IsosTaskActionInfo* genericTaskActionInfo;
-
-void Isos_Init(){ //just to be safe, zeroes everything out
-  memset(IsosTaskList, 0, sizeof(IsosTaskList));
-  memset(IsosDueTaskList, 0, sizeof(IsosDueTaskList));
-  memset(IsosResourceTaskList, 0, sizeof(IsosResourceTaskList));
-  memset(IsosResourceTaskClaimerList, -1, sizeof(IsosResourceTaskClaimerList)); //initialized as -1 instead of 0
-  memset(IsosResourceTaskBufferList, 0, sizeof(IsosResourceTaskBufferList));
-  memset(&IsosMainClock, 0, sizeof(IsosMainClock));
-  memset(&LastSchedulerRun, 0, sizeof(LastSchedulerRun));
-  memset(&LastSchedulerFinished, 0, sizeof(LastSchedulerFinished));
-  SchedulerPeriod.Day = CLOCK_PERIOD_DAY;
-  SchedulerPeriod.Ms = CLOCK_PERIOD_MS;
-  IsosDueTaskSize = 0;
-  IsosTaskSize = 0;
-  IsosRequestSorting = 0;
-}
-
-void Isos_prepareGenericTaskPointersById(unsigned char taskId){
-  genericTask = &IsosTaskList[taskId];
-  genericTaskInfo = &genericTask->Info;
-  genericTaskActionInfo = &genericTaskInfo->ActionInfo;
-}
-
-IsosClock Isos_GetClock(){ return IsosMainClock; } //create a copy of main clock for use
-
-unsigned char Isos_GetTaskFlags(unsigned char taskId, unsigned char flagNo){
-  if (taskId < 0 || taskId >= IsosTaskSize || flagNo < 0 || flagNo >= TASK_FLAGS_SIZE)
+//To take the next per-task array from the arena, every array starts aligned
+void* Isos_takeFromArena(unsigned char** arenaPointer, long size){
+  void* section = *arenaPointer;
+  *arenaPointer += (size + ISOS_ARENA_ALIGNMENT - 1) / ISOS_ARENA_ALIGNMENT * ISOS_ARENA_ALIGNMENT;
+  return section;
+}
+
+char IsosKernel_InitWithArena(IsosKernel* kernel, void* arena, long arenaSize, short resourceCapacity, short eventGroupCapacity, short mailboxCapacity){ //just to be safe, zeroes everything out
+  unsigned char* arenaPointer = arena;
+  IsosHeapItem *nextDueHeapItems, *sleepHeapItems, *timeoutHeapItems;
+  short *nextDueHeapPositions, *sleepHeapPositions, *timeoutHeapPositions;
+  long taskCapacity;
+  if (resourceCapacity < 0 || eventGroupCapacity < 0 || mailboxCapacity < 0 ||
+      arenaSize < (long)ISOS_ARENA_SIZE(MIN_TASK_SIZE, resourceCapacity, eventGroupCapacity, mailboxCapacity))
+    return 0; //the arena is too small to run the OS
+  taskCapacity = (arenaSize - (long)ISOS_ARENA_SIZE(0, resourceCapacity, eventGroupCapacity, mailboxCapacity)) / (long)ISOS_ARENA_BYTES_PER_TASK;
+  kernel->ResourceCapacity = resourceCapacity;
+  kernel->EventGroupCapacity = eventGroupCapacity;
+  kernel->MailboxCapacity = mailboxCapacity;
+  kernel->TaskCapacity = taskCapacity > ISOS_MAX_TASK_CAPACITY ? ISOS_MAX_TASK_CAPACITY : (short)taskCapacity;
+  kernel->TaskList = Isos_takeFromArena(&arenaPointer, sizeof(IsosTask) * kernel->TaskCapacity);
+  kernel->ReadyQueueLinks = Isos_takeFromArena(&arenaPointer, sizeof(IsosReadyQueueLink) * kernel->TaskCapacity);
+  nextDueHeapItems = Isos_takeFromArena(&arenaPointer, sizeof(IsosHeapItem) * kernel->TaskCapacity);
+  nextDueHeapPositions = Isos_takeFromArena(&arenaPointer, sizeof(short) * kernel->TaskCapacity);
+  sleepHeapItems = Isos_takeFromArena(&arenaPointer, sizeof(IsosHeapItem) * kernel->TaskCapacity);
+  sleepHeapPositions = Isos_takeFromArena(&arenaPointer, sizeof(short) * kernel->TaskCapacity);
+  timeoutHeapItems = Isos_takeFromArena(&arenaPointer, sizeof(IsosHeapItem) * kernel->TaskCapacity);
+  timeoutHeapPositions = Isos_takeFromArena(&arenaPointer, sizeof(short) * kernel->TaskCapacity);
+  #if BASIC_DEBUG
+  kernel->DueTaskSnapshot = Isos_takeFromArena(&arenaPointer, sizeof(IsosDueTask) * kernel->TaskCapacity);
+  #else
+  kernel->DueTaskSnapshot = (void*)0;
+  #endif // BASIC_DEBUG
+  kernel->ParallelTaskIds = Isos_takeFromArena(&arenaPointer, sizeof(short) * kernel->TaskCapacity);
+  kernel->Executor = (void*)0; //all tasks run on the calling thread until an executor is started
+  kernel->ResourceWaiters = Isos_takeFromArena(&arenaPointer, sizeof(IsosResourceWaiter) * kernel->TaskCapacity);
+  kernel->FirstClaimedResources = Isos_takeFromArena(&arenaPointer, sizeof(short) * kernel->TaskCapacity);
+  kernel->Resources = Isos_takeFromArena(&arenaPointer, sizeof(IsosResource) * kernel->ResourceCapacity);
+  kernel->ResourceBuffers = Isos_takeFromArena(&arenaPointer, sizeof(IsosBuffer) * 2 * kernel->ResourceCapacity);
+  kernel->EventGroups = Isos_takeFromArena(&arenaPointer, sizeof(IsosEventGroup) * kernel->EventGroupCapacity);
+  kernel->EventWaiters = Isos_takeFromArena(&arenaPointer, sizeof(IsosEventWaiter) * kernel->TaskCapacity);
+  kernel->Mailboxes = Isos_takeFromArena(&arenaPointer, sizeof(IsosMailbox) * kernel->MailboxCapacity);
+  kernel->MailboxWaiters = Isos_takeFromArena(&arenaPointer, sizeof(IsosMailboxWaiter) * kernel->TaskCapacity);
+  #if ISOS_TASK_STATS
+  kernel->TaskStats = Isos_takeFromArena(&arenaPointer, sizeof(IsosTaskStats) * kernel->TaskCapacity);
+  #endif // ISOS_TASK_STATS
+  memset(kernel->TaskList, 0, sizeof(IsosTask) * kernel->TaskCapacity);
+  IsosReadyQueue_InitLinks(kernel->ReadyQueueLinks, kernel->TaskCapacity);
+  IsosReadyQueue_Init(&kernel->ReadyQueues[0], kernel->ReadyQueueLinks);
+  IsosReadyQueue_Init(&kernel->ReadyQueues[1], kernel->ReadyQueueLinks);
+  kernel->CurrentReadyQueue = &kernel->ReadyQueues[0];
+  kernel->NextReadyQueue = &kernel->ReadyQueues[1];
+  kernel->ImmediateTaskSize = 0;
+  IsosHeap_Init(&kernel->NextDueHeap, nextDueHeapItems, nextDueHeapPositions, kernel->TaskCapacity);
+  IsosHeap_Init(&kernel->SleepHeap, sleepHeapItems, sleepHeapPositions, kernel->TaskCapacity);
+  IsosHeap_Init(&kernel->TimeoutHeap, timeoutHeapItems, timeoutHeapPositions, kernel->TaskCapacity);
+  kernel->ResourceSize = 0; //the entries are initialized on registration
+  IsosBuffer_Init(&kernel->NullResourceBuffer, NullBuffer, 0);
+  kernel->EventGroupSize = 0; //the groups are initialized on registration
+  ISOS_EVENT_INIT(kernel->HasPendingEvents);
+  kernel->WakeUpAction = (void*)0;
+  kernel->WakeUpArgument = (void*)0;
+  IsosBlockPool_Init(&kernel->MessagePool, (void*)0, 0, 0); //no block until the message pool is given
+  kernel->MailboxSize = 0; //the mailboxes are initialized on registration
+  memset(&kernel->MainClock, 0, sizeof(kernel->MainClock));
+  memset(&kernel->LastSchedulerRun, 0, sizeof(kernel->LastSchedulerRun));
+  memset(&kernel->LastSchedulerFinished, 0, sizeof(kernel->LastSchedulerFinished));
+  kernel->SchedulerPeriod = IsosClock_Create(CLOCK_PERIOD_DAY, CLOCK_PERIOD_MS);
+  kernel->TaskSize = 0;
+  kernel->LastClaimedResourceTask = IsosResourceTaskType_Unspecified;
+  kernel->FirstReleasedResource = -1;
+  #if ISOS_PROFILING
+  IsosKernel_ResetProfile(kernel);
+  #endif // ISOS_PROFILING
+  #if ISOS_TRACE
+  kernel->Trace = (void*)0;
+  #endif // ISOS_TRACE
+  #if ISOS_TRACE_RING
+  kernel->TraceRing = (void*)0;
+  #endif // ISOS_TRACE_RING
+  return 1;
+}
+
+IsosKernel* IsosKernel_GetDefault(){ return &IsosDefaultKernel; }
+
+IsosKernel* IsosKernel_GetCurrent(){ return IsosCurrentKernel; }
+
+void IsosKernel_SetCurrent(IsosKernel* kernel){ IsosCurrentKernel = kernel; }
+
+#if ISOS_PARALLEL_EXECUTOR
+void IsosKernel_SetCurrentWorker(IsosKernel* kernel){
+  IsosCurrentKernel = kernel;
+  IsosWorkerKernel = kernel;
+}
+#endif // ISOS_PARALLEL_EXECUTOR
+
+//The kernel state is only changed on its scheduler thread, the functions changing it refuse the calls from its executor worker threads
+char IsosKernel_isOnWorkerThread(IsosKernel* kernel){ return kernel == IsosWorkerKernel; }
+
+IsosClock IsosKernel_GetClock(IsosKernel* kernel){ return kernel->MainClock; } //create a copy of main clock for use
+
+unsigned char IsosKernel_GetTaskFlags(IsosKernel* kernel, short taskId, unsigned char flagNo){
+  IsosTaskInfo* taskInfo;
+  if (taskId < 0 || taskId >= kernel->TaskSize || flagNo < 0 || flagNo >= TASK_FLAGS_SIZE)
     return 0; //no raised flag should be return for invalid input case
-  Isos_prepareGenericTaskPointersById(taskId);
-  return genericTaskActionInfo->Flags[flagNo];
+  taskInfo = &kernel->TaskList[taskId].Info;
+  return taskInfo->ActionInfo.Flags[flagNo];
 }
 
 //May not really be the best way to expose tasks to the outsider, but this function is assumed to be called only by "super-user"
-IsosTask* Isos_GetTask(unsigned char taskId){
-  if (taskId < 0 || taskId >= IsosTaskSize)
+IsosTask* IsosKernel_GetTask(IsosKernel* kernel, short taskId){
+  if (taskId < 0 || taskId >= kernel->TaskSize)
     return (void *)0; //null pointer
-  return &IsosTaskList[taskId];
+  return &kernel->TaskList[taskId];
 }
 
-short Isos_GetTaskSize(){ return IsosTaskSize; }
+short IsosKernel_GetTaskSize(IsosKernel* kernel){ return kernel->TaskSize; }
 
-void Isos_SetTaskTimeout(unsigned char taskId, short timeoutDay, long timeoutMs){
-  if (taskId < 0 || taskId >= IsosTaskSize)
+short IsosKernel_GetTaskCapacity(IsosKernel* kernel){ return kernel->TaskCapacity; }
+
+//Must be called whenever the execution start, the timeout or the state of a started task is changed, so that the timeout deadlines are kept up-to-date
+//A task is started from its (first) execution until it is completed, whether it is running, suspended or blocked in between
+void IsosKernel_updateTimeoutDeadline(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  if (IsosClock_IsZero(&taskInfo->Timeout) || !taskInfo->IsDueReported ||
+      (taskInfo->ActionInfo.State != IsosTaskState_Running && taskInfo->ActionInfo.State != IsosTaskState_Suspended)){
+    IsosHeap_Remove(&kernel->TimeoutHeap, taskInfo->Id);
     return;
-  Isos_prepareGenericTaskPointersById(taskId);
-  genericTaskInfo->Timeout = IsosClock_Create(timeoutDay, timeoutMs);
+  }
+  IsosHeap_Put(&kernel->TimeoutHeap, taskInfo->Id, IsosClock_Add(&taskInfo->LastExecuted, &taskInfo->Timeout));
 }
 
-void Isos_initClockToNow(IsosTaskInfo* taskInfo){
+void IsosKernel_SetTaskTimeout(IsosKernel* kernel, short taskId, short timeoutDay, long timeoutMs){
+  IsosTaskInfo* taskInfo;
+  if (taskId < 0 || taskId >= kernel->TaskSize || IsosKernel_isOnWorkerThread(kernel))
+    return;
+  taskInfo = &kernel->TaskList[taskId].Info;
+  taskInfo->Timeout = IsosClock_Create(timeoutDay, timeoutMs);
+  if (IsosHeap_Contains(&kernel->TimeoutHeap, taskId)) //a task which is not started yet gets its deadline when it is started
+    IsosKernel_updateTimeoutDeadline(kernel, taskInfo);
+}
+
+//A task is waiting for its due only if it is enabled, not yet reported, and not suspended (unless it is forced to due)
+char Isos_isWaitingForDue(const IsosTaskInfo* taskInfo){
+  if (taskInfo->IsDueReported || !taskInfo->ActionInfo.Enabled)
+    return 0;
+  return taskInfo->ForcedDue || taskInfo->ActionInfo.State != IsosTaskState_Suspended;
+}
+
+//Must be called whenever anything deciding the due of a task is changed, so that the next-due index is kept up-to-date
+void IsosKernel_updateNextDue(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  if (!Isos_isWaitingForDue(taskInfo)){
+    IsosHeap_Remove(&kernel->NextDueHeap, taskInfo->Id);
+    return;
+  }
+  //forced due task is keyed with the earliest possible clock, so that it is always due on the next scheduler run
+  IsosHeap_Put(&kernel->NextDueHeap, taskInfo->Id, taskInfo->ForcedDue ? IsosClock_Create(0, 0) : IsosTask_GetNextDue(taskInfo));
+}
+
+void IsosKernel_SetTaskEnabled(IsosKernel* kernel, short taskId, char enabled){
+  IsosTaskInfo* taskInfo;
+  if (taskId < 0 || taskId >= kernel->TaskSize || IsosKernel_isOnWorkerThread(kernel))
+    return;
+  taskInfo = &kernel->TaskList[taskId].Info;
+  taskInfo->ActionInfo.Enabled = enabled;
+  IsosKernel_updateNextDue(kernel, taskInfo);
+}
+
+//Resource tasks are dued by their claimers and released by them, so they always run on the scheduler thread
+char IsosKernel_SetTaskParallelSafe(IsosKernel* kernel, short taskId, char parallelSafe){
+  IsosTaskInfo* taskInfo;
+  if (taskId < 0 || taskId >= kernel->TaskSize || IsosKernel_isOnWorkerThread(kernel))
+    return 0;
+  taskInfo = &kernel->TaskList[taskId].Info;
+  if (parallelSafe && taskInfo->Type == IsosTaskType_Resource)
+    return 0;
+  taskInfo->ParallelSafe = parallelSafe;
+  return 1;
+}
+
+#if ISOS_PARALLEL_EXECUTOR
+void IsosKernel_SetExecutor(IsosKernel* kernel, struct IsosExecutorStruct* executor){ kernel->Executor = executor; }
+#endif // ISOS_PARALLEL_EXECUTOR
+
+void IsosKernel_initClockToNow(IsosKernel* kernel, IsosTaskInfo* taskInfo){
   IsosClock clock;
-  clock = Isos_GetClock();
+  clock = IsosKernel_GetClock(kernel);
   taskInfo->LastDueReported = clock;
   taskInfo->LastExecuted = clock;
   taskInfo->LastFinished = clock;
   taskInfo->SuspensionInfo.Due = clock;
 }
 
-void Isos_queueOnDueHandled(IsosTaskInfo* taskInfo, IsosClock* clock){
+void IsosKernel_queueOnDueHandled(IsosKernel* kernel, IsosTaskInfo* taskInfo, IsosClock* clock){
   taskInfo->ForcedDue = 0; //whatever happen, reset the force run now flag here
   taskInfo->IsDueReported = 1; //report that this task has been queued
   taskInfo->LastDueReported = *clock; //record this due reported time
-  IsosRequestSorting = 1; //raise flag to force the sorting next time the scheduler is run (due to the newly claimed resource task)
+  IsosHeap_Remove(&kernel->NextDueHeap, taskInfo->Id); //reported task is no longer waiting for its due
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_TASK, IsosTraceEventType_Due, taskInfo->Id, taskInfo->Priority, 0);
 }
 
-void Isos_queueOnDue(IsosTaskInfo* taskInfo, IsosClock clock){
-  IsosDueTaskList[IsosDueTaskSize].TaskId = taskInfo->Id;
-  IsosDueTaskList[IsosDueTaskSize].Priority = taskInfo->Priority;
-  IsosDueTaskSize++;
-  Isos_queueOnDueHandled(taskInfo, &clock);
+void IsosKernel_queueOnDue(IsosKernel* kernel, IsosTaskInfo* taskInfo, IsosClock clock){
+  IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority);
+  IsosKernel_queueOnDueHandled(kernel, taskInfo, &clock);
 }
 
-void Isos_removeDueTaskByIndex(short dueTaskIndex){
-  if (dueTaskIndex >= IsosDueTaskSize)
-    return; //cannot exceed the boundary
-  if (dueTaskIndex < IsosDueTaskSize - 1) //NOT the last element
-    // example: size = 10, i = 6, then 6-9 (4 items) is replaced by 7-9 (3 items)
-    memcpy(&IsosDueTaskList[dueTaskIndex], &IsosDueTaskList[dueTaskIndex + 1], sizeof(IsosDueTask) * (IsosDueTaskSize - (dueTaskIndex + 1)));
-  IsosDueTaskSize--; //Reduce the size. If this is the last element no memcpy needed
+void IsosKernel_removeImmediateTask(IsosKernel* kernel, short taskId){
+  short i;
+  for (i = 0; i < kernel->ImmediateTaskSize; ++i) //very short list, at most IMMEDIATE_TASK_SIZE
+    if (kernel->ImmediateTaskIds[i] == taskId){
+      memmove(&kernel->ImmediateTaskIds[i], &kernel->ImmediateTaskIds[i + 1], sizeof(short) * (kernel->ImmediateTaskSize - (i + 1)));
+      kernel->ImmediateTaskSize--;
+      return;
+    }
 }
 
-void Isos_dequeueFromDue(unsigned char taskId){
-  short i;
-  if (IsosDueTaskSize == 0) //cannot dequeue anything
+void IsosKernel_dequeueFromDue(IsosKernel* kernel, short taskId){
+  //the task can only be in one of the queues (or the sleep queue), and removal from each ready queue is constant time
+  if (IsosReadyQueue_Remove(kernel->CurrentReadyQueue, taskId) || IsosReadyQueue_Remove(kernel->NextReadyQueue, taskId))
     return;
-  if (IsosDueTaskSize == 1){ //immediately empties the current list
-    memset(IsosDueTaskList, 0, sizeof(IsosDueTaskList));
-    IsosDueTaskSize = 0; //return the due task size back to zero
-    return;
-  }
-  //In all likelihood, the reverse order search would be faster
-  for (i = IsosDueTaskSize - 1; i >= 0; --i) //going through the list
-    if (IsosDueTaskList[i].TaskId == taskId){
-      Isos_removeDueTaskByIndex(i);
-      break;
-    }
+  IsosHeap_Remove(&kernel->SleepHeap, taskId);
+  IsosKernel_removeImmediateTask(kernel, taskId);
 }
 
-void Isos_insertTaskOnDue(short currentRunningTaskIndex, IsosTaskInfo* taskInfo, IsosClock clock){
-  short prevIndex, tailTaskNo;
-  if (currentRunningTaskIndex < 0) //does not make sense
+//A sleeping task woken up before its suspension due goes back to the current queue, so that it can be found in the queues again
+void IsosKernel_endSleep(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  if (!IsosHeap_Contains(&kernel->SleepHeap, taskInfo->Id))
     return;
-  if (IsosDueTaskSize <= 0){
-    Isos_queueOnDue(taskInfo, clock); //just queue normally - this should be an impossible case though
+  IsosHeap_Remove(&kernel->SleepHeap, taskInfo->Id);
+  IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority);
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_WAIT, IsosTraceEventType_Wake, taskInfo->Id, 0, 0);
+}
+
+//To run a due task right after the currently running one, ahead of everything else in the current queue
+void IsosKernel_runImmediately(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  IsosKernel_dequeueFromDue(kernel, taskInfo->Id);
+  if (kernel->ImmediateTaskSize >= IMMEDIATE_TASK_SIZE){ //should not happen, but if it does, the task still needs to be run
+    IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority);
     return;
   }
-  prevIndex = IsosDueTaskSize - 1;
-  if (currentRunningTaskIndex == prevIndex){ //simply shift the current one to the next position
-    IsosDueTaskList[IsosDueTaskSize].TaskId = IsosDueTaskList[prevIndex].TaskId;
-    IsosDueTaskList[IsosDueTaskSize].Priority = IsosDueTaskList[prevIndex].Priority;
-    IsosDueTaskList[prevIndex].TaskId = taskInfo->Id;
-    IsosDueTaskList[prevIndex].Priority = taskInfo->Priority;
-  } else { //All the memcpy is used for all non trivial cases
-    tailTaskNo = IsosDueTaskSize - currentRunningTaskIndex; //no of task after the currently running one
-    memcpy(&IsosDueTaskList[currentRunningTaskIndex + 1], &IsosDueTaskList[currentRunningTaskIndex], sizeof(IsosDueTask) * tailTaskNo);
-    IsosDueTaskList[currentRunningTaskIndex].TaskId = taskInfo->Id;
-    IsosDueTaskList[currentRunningTaskIndex].Priority = taskInfo->Priority;
+  kernel->ImmediateTaskIds[kernel->ImmediateTaskSize] = taskInfo->Id;
+  kernel->ImmediateTaskSize++;
+}
+
+//A blocked task is in none of the queues and not in the next-due index until it is woken up, so waiting costs no scheduler work
+void IsosKernel_blockTask(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  taskInfo->ActionInfo.State = IsosTaskState_Suspended;
+  taskInfo->IsBlocked = 1;
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_WAIT, IsosTraceEventType_Suspend, taskInfo->Id, 0, -1);
+  IsosKernel_dequeueFromDue(kernel, taskInfo->Id); //normally the task is running now, thus in no queue, and it will not be re-queued after its execution
+  IsosKernel_updateNextDue(kernel, taskInfo);
+}
+
+void IsosKernel_wakeTask(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  if (!taskInfo->IsBlocked)
+    return;
+  taskInfo->IsBlocked = 0;
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_WAIT, IsosTraceEventType_Wake, taskInfo->Id, 0, 0);
+  if (taskInfo->ActionInfo.State == IsosTaskState_Suspended)
+    taskInfo->ActionInfo.State = IsosTaskState_Running; //continues where it stopped, not a new execution
+  if (taskInfo->IsDueReported){ //DO NOT change the due reported time
+    IsosKernel_dequeueFromDue(kernel, taskInfo->Id);
+    IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority); //on its own priority, not ahead of the higher priority ready tasks
+  } else
+    IsosKernel_updateNextDue(kernel, taskInfo);
+}
+
+//Re-queue the due task on its (possibly changed) priority level, in whichever queue it is
+void IsosKernel_requeueOnPriority(IsosKernel* kernel, IsosTaskInfo* taskInfo){
+  if (IsosReadyQueue_Remove(kernel->CurrentReadyQueue, taskInfo->Id))
+    IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority);
+  else if (IsosReadyQueue_Remove(kernel->NextReadyQueue, taskInfo->Id))
+    IsosReadyQueue_Push(kernel->NextReadyQueue, taskInfo->Id, taskInfo->Priority);
+}
+
+//The next task to run in this scheduler run: the immediate tasks first, then the highest priority task in the current queue
+short IsosKernel_takeNextTaskToRun(IsosKernel* kernel){
+  if (kernel->ImmediateTaskSize > 0){
+    kernel->ImmediateTaskSize--;
+    return kernel->ImmediateTaskIds[kernel->ImmediateTaskSize];
   }
-  IsosDueTaskSize++;
-  Isos_queueOnDueHandled(taskInfo, &clock);
+  return IsosReadyQueue_PopHighest(kernel->CurrentReadyQueue);
 }
 
-void Isos_prepareToDueTask(IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
+void IsosKernel_prepareToDueTask(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
+  if (taskInfo->IsBlocked){ //forced out of its blocking, put it back to the current queue so that it can be found below
+    taskInfo->IsBlocked = 0;
+    if (taskInfo->IsDueReported)
+      IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskInfo->Id, taskInfo->Priority);
+  }
+  IsosKernel_endSleep(kernel, taskInfo);
   if (taskInfo->ActionInfo.State == IsosTaskState_Suspended) //if the task has been suspended before, then the state will need to be changed to running first
     taskInfo->ActionInfo.State = IsosTaskState_Running; //otherwise, don't change the state, just ask to be re-run will do
   taskInfo->Priority = priority; //change the priority of the task first
   taskInfo->ActionInfo.Enabled = 1; //whatever happen, enable it
   if (withReset) {
     if (taskInfo->IsDueReported) //takes away the task from the due list before reseting the state
-      Isos_dequeueFromDue(taskInfo->Id);
+      IsosKernel_dequeueFromDue(kernel, taskInfo->Id);
     IsosTask_ResetState(taskInfo); //reset the state if required
+    IsosHeap_Remove(&kernel->TimeoutHeap, taskInfo->Id); //to be started all over again
   }
   if (taskInfo->IsDueReported) //already in the task list to run, just continue, no need to re-run
-    IsosRequestSorting = 1; //no need to report to run the task again, just need to do re-sorting in case priority changes
+    IsosKernel_requeueOnPriority(kernel, taskInfo); //no need to report to run the task again, just need to re-queue it in case priority changes
 }
 
-void Isos_commonPrepareDueNonCyclicalTask(IsosTaskInfo* taskInfo, unsigned char priority, char withReset, IsosClock clock){
-  Isos_prepareToDueTask(taskInfo, priority, withReset);
+void IsosKernel_commonPrepareDueNonCyclicalTask(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset, IsosClock clock){
+  IsosKernel_prepareToDueTask(kernel, taskInfo, priority, withReset);
   if (taskInfo->IsDueReported) //already in the task list to run, just continue, no need to re-run
     return;
-  taskInfo->TimeInfo.ExecutionDue.Day = clock.Day;
-  taskInfo->TimeInfo.ExecutionDue.Ms = clock.Ms;
+  taskInfo->TimeInfo.ExecutionDue = clock;
+  IsosKernel_updateNextDue(kernel, taskInfo);
 }
 
-void Isos_scheduler(){
-  //the main loop to check every task
+void IsosKernel_scheduler(IsosKernel* kernel){
+  //only the tasks on top of the next-due index need to be checked, the rest cannot be due earlier than them
   IsosTaskInfo* taskInfo;
-  IsosClock mainClock;
-  short i = 0;
-  mainClock = Isos_GetClock(); //freezes the clock when checking the due
-  for (i = 0; i < IsosTaskSize; ++i){
-    taskInfo = &IsosTaskList[i].Info;
-    if (taskInfo->IsDueReported || !taskInfo->ActionInfo.Enabled) //no need to process reported or disabled task further
+  IsosClock mainClock, due;
+  short taskId;
+  mainClock = IsosKernel_GetClock(kernel); //freezes the clock when checking the due
+  while (IsosHeap_Peek(&kernel->NextDueHeap, &taskId, &due)){
+    if (IsosClock_Compare(&mainClock, &due) < 0) //the earliest due has not come yet, so nothing else is due
+      break;
+    IsosHeap_Pop(&kernel->NextDueHeap, &taskId, &due);
+    taskInfo = &kernel->TaskList[taskId].Info;
+    if (!Isos_isWaitingForDue(taskInfo)) //the task could have been changed directly (i.e. disabled by the "super user"), just drop it
       continue;
-    if (!taskInfo->ForcedDue && //if the task is not being forced run and in the suspended state, do not run, any other state is valid to re-run the task
-      (taskInfo->ActionInfo.State == IsosTaskState_Suspended)) //naturally, task should not be in suspended state on the time it is to be due
-      continue; //only if the due is not reported then we need to report, otherwise, just leave it
-    if (taskInfo->ForcedDue || IsosTask_IsDue(&mainClock, taskInfo)) //internally is due does not check anything except the time
-      Isos_queueOnDue(taskInfo, mainClock); //queue the tasks
+    IsosKernel_queueOnDue(kernel, taskInfo, mainClock); //queue the tasks
+  }
+  //likewise, only the sleeping tasks on top of the sleep queue need to be checked, they are back in the current queue once their suspension is due
+  while (IsosHeap_Peek(&kernel->SleepHeap, &taskId, &due)){
+    if (IsosClock_Compare(&mainClock, &due) < 0)
+      break;
+    IsosHeap_Pop(&kernel->SleepHeap, &taskId, &due);
+    IsosReadyQueue_Push(kernel->CurrentReadyQueue, taskId, kernel->TaskList[taskId].Info.Priority); //DO NOT change the due reported time
+    ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_WAIT, IsosTraceEventType_Wake, taskId, 1, 0);
   }
+}
 
-  //only if the task has changes or request sort flag is raise then we *may* need to rearrange the due tasks
-  if (IsosRequestSorting){
-    IsosRequestSorting = 0; //reset the request sorting flag
-    if (IsosDueTaskSize > 1) //only if due task size > 1 then this actually really needs re-sorting
-      Isos_QuickSortAsc(IsosDueTaskList, 0, IsosDueTaskSize-1); //use ASC so that it is easier to remove the last task
+//The claimer of a resource and the list of the resources claimed by every task must always be changed together
+void IsosKernel_setResourceClaimer(IsosKernel* kernel, IsosResourceTaskType type, short claimerId){
+  IsosResource* resource = &kernel->Resources[type];
+  short* link;
+  if (resource->ClaimerId >= 0){ //a task holds very few resources, the list is short
+    for (link = &kernel->FirstClaimedResources[resource->ClaimerId]; *link != type; link = &kernel->Resources[*link].NextClaimed);
+    *link = resource->NextClaimed;
   }
+  resource->NextClaimed = -1;
+  if (claimerId >= 0){
+    resource->NextClaimed = kernel->FirstClaimedResources[claimerId];
+    kernel->FirstClaimedResources[claimerId] = type;
+  }
+  resource->ClaimerId = claimerId;
 }
 
-IsosResourceTaskType Isos_getClaimedResourceTaskType(unsigned char taskId){
+//Releases all the resource tasks claimed by (or handed over to) the task, the waiters are handled immediately outside
+void IsosKernel_releaseClaimedResources(IsosKernel* kernel, short taskId, char handedOverOnly){
+  short type, nextType;
+  for (type = kernel->FirstClaimedResources[taskId]; type >= 0; type = nextType){
+    nextType = kernel->Resources[type].NextClaimed; //the release takes the resource out of the list
+    if (!handedOverOnly || kernel->Resources[type].HandedOver)
+      IsosKernel_ReleaseResourceTask(kernel, type);
+  }
+}
+
+IsosBuffer* IsosKernel_getResourceBuffer(IsosKernel* kernel, IsosResourceTaskType type, char isTx){
+  if (kernel->Resources[type].BufferIndex < 0) //no buffer, the shared empty buffer stands for it
+    return &kernel->NullResourceBuffer;
+  return &kernel->ResourceBuffers[kernel->Resources[type].BufferIndex + !isTx];
+}
+
+//Puts the resource task in its entry of the resource table, its Tx and Rx buffers are only used if it has any
+char IsosKernel_putResource(IsosKernel* kernel, IsosResourceTaskType type, short taskId, unsigned char* txBuffer, short txBufferSize,
+                            unsigned char* rxBuffer, short rxBufferSize){
+  IsosResource* resource;
   short i;
-  for (i = 0; i < RESOURCE_SIZE; ++i)
-    if (IsosResourceTaskClaimerList[i] == taskId)
-      return i;
-  return IsosResourceTaskType_Unspecified;
+  if (type < 0 || type >= kernel->ResourceCapacity || (type < kernel->ResourceSize && kernel->Resources[type].TaskId >= 0))
+    return 0; //out of the table or already registered
+  for (i = kernel->ResourceSize; i <= type; ++i) //the entries skipped over are left unregistered
+    kernel->Resources[i].TaskId = -1;
+  if (type >= kernel->ResourceSize)
+    kernel->ResourceSize = type + 1;
+  resource = &kernel->Resources[type];
+  resource->TaskId = taskId;
+  resource->ClaimerId = -1;
+  resource->FirstWaiterId = -1;
+  resource->BufferIndex = -1;
+  resource->NextClaimed = -1;
+  resource->NextReleased = -1;
+  resource->HandedOver = 0;
+  resource->Awaited = 0;
+  resource->Released = 0;
+  if (txBufferSize > 0 || rxBufferSize > 0){
+    resource->BufferIndex = 2 * type;
+    IsosBuffer_Init(&kernel->ResourceBuffers[resource->BufferIndex], txBuffer, txBufferSize); //Tx buffer
+    IsosBuffer_Init(&kernel->ResourceBuffers[resource->BufferIndex + 1], rxBuffer, rxBufferSize); //Rx buffer
+  }
+  return 1;
+}
+
+//Takes the task out of the waiter queue it is in, if any
+void IsosKernel_removeResourceWaiter(IsosKernel* kernel, short taskId){
+  IsosResourceWaiter* waiter = &kernel->ResourceWaiters[taskId];
+  short* link;
+  if (waiter->Type == IsosResourceTaskType_Unspecified) //not waiting
+    return;
+  for (link = &kernel->Resources[waiter->Type].FirstWaiterId; *link != taskId; link = &kernel->ResourceWaiters[*link].Next);
+  *link = waiter->Next;
+  waiter->Next = -1;
+  waiter->Type = IsosResourceTaskType_Unspecified;
+}
+
+//Queues the task as a waiter of the resource task, after all the waiters with the same or higher priority
+//A task already waiting for this resource task keeps its place, a task waits for one resource task at a time
+void IsosKernel_putResourceWaiter(IsosKernel* kernel, IsosResourceTaskType type, short taskId, unsigned char priority){
+  IsosResourceWaiter* waiter = &kernel->ResourceWaiters[taskId];
+  short* link;
+  if (waiter->Type == type)
+    return;
+  IsosKernel_removeResourceWaiter(kernel, taskId);
+  for (link = &kernel->Resources[type].FirstWaiterId; *link >= 0 && kernel->ResourceWaiters[*link].Priority >= priority; link = &kernel->ResourceWaiters[*link].Next);
+  waiter->Next = *link;
+  waiter->Type = type;
+  waiter->Priority = priority;
+  *link = taskId;
+}
+
+//Hands the just released resource task over to the first waiter which is still on due, the ones which are not are dropped
+//The waiter becomes the claimer right away, so that nobody else can take the resource task before the waiter claims it
+void IsosKernel_handOverResource(IsosKernel* kernel, IsosResourceTaskType type){
+  short waiterId;
+  IsosTaskInfo* waiterInfo;
+  while ((waiterId = kernel->Resources[type].FirstWaiterId) >= 0){
+    IsosKernel_removeResourceWaiter(kernel, waiterId);
+    waiterInfo = &kernel->TaskList[waiterId].Info;
+    if (waiterInfo->IsDueReported && waiterInfo->ActionInfo.Enabled){
+      IsosKernel_setResourceClaimer(kernel, type, waiterId);
+      kernel->Resources[type].HandedOver = 1;
+      return;
+    }
+  }
+}
+
+//Wakes up the claimer blocked until the just completed resource task completes
+void IsosKernel_wakeResourceClaimer(IsosKernel* kernel, short taskId){
+  short type, claimerId;
+  type = kernel->TaskList[taskId].Info.ResourceType;
+  if (type < 0 || kernel->Resources[type].TaskId != taskId || !kernel->Resources[type].Awaited)
+    return; //not a resource task (anymore), or nobody waits for it
+  kernel->Resources[type].Awaited = 0;
+  claimerId = kernel->Resources[type].ClaimerId;
+  if (claimerId < 0)
+    return;
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintResourceWakingNote(claimerId, type);
+  #endif // BASIC_DEBUG
+  IsosKernel_wakeTask(kernel, &kernel->TaskList[claimerId].Info);
+}
+
+//Releases the resource tasks handed over to the task but never claimed by it, the task has given up (completed) while waiting
+void IsosKernel_dropResourceWaits(IsosKernel* kernel, short taskId){
+  IsosKernel_removeResourceWaiter(kernel, taskId);
+  IsosKernel_releaseClaimedResources(kernel, taskId, 1); //passes them on to the next waiters
+}
+
+//Takes the task out of the waiter list of the event group it waits on, if any
+void IsosKernel_removeEventWaiter(IsosKernel* kernel, short taskId){
+  IsosEventWaiter* waiter = &kernel->EventWaiters[taskId];
+  short* link;
+  if (waiter->Group < 0) //not waiting
+    return;
+  for (link = &kernel->EventGroups[waiter->Group].FirstWaiterId; *link != taskId; link = &kernel->EventWaiters[*link].Next);
+  *link = waiter->Next;
+  waiter->Next = -1;
+  waiter->Group = -1;
+}
+
+//Sets the bits of the (valid) event group, every waiter whose waited bits are now set is taken out of the list and woken up at once
+void IsosKernel_setGroupEvents(IsosKernel* kernel, short group, IsosEventBits bits){
+  IsosEventGroup* eventGroup = &kernel->EventGroups[group];
+  IsosEventWaiter* waiter;
+  short* link;
+  short waiterId;
+  eventGroup->Bits |= bits;
+  link = &eventGroup->FirstWaiterId;
+  while ((waiterId = *link) >= 0){
+    waiter = &kernel->EventWaiters[waiterId];
+    if (!IsosEventGroup_Matches(eventGroup->Bits, waiter->Bits, waiter->WaitAll)){
+      link = &waiter->Next;
+      continue;
+    }
+    *link = waiter->Next;
+    waiter->Next = -1;
+    waiter->Group = -1;
+    #if BASIC_DEBUG
+    IsosDebugBasic_PrintEventWakingNote(waiterId, group, eventGroup->Bits);
+    #endif // BASIC_DEBUG
+    IsosKernel_wakeTask(kernel, &kernel->TaskList[waiterId].Info);
+  }
+}
+
+//Takes the task out of the receiver queue of the mailbox it waits on, if any
+void IsosKernel_removeMailboxWaiter(IsosKernel* kernel, short taskId){
+  IsosMailboxWaiter* waiter = &kernel->MailboxWaiters[taskId];
+  short* link;
+  if (waiter->Mailbox < 0) //not waiting
+    return;
+  for (link = &kernel->Mailboxes[waiter->Mailbox].FirstWaiterId; *link != taskId; link = &kernel->MailboxWaiters[*link].Next);
+  *link = waiter->Next;
+  waiter->Next = -1;
+  waiter->Mailbox = -1;
+}
+
+//Queues the task as a receiver of the mailbox, after all the receivers with the same or higher priority
+void IsosKernel_putMailboxWaiter(IsosKernel* kernel, short mailbox, short taskId, unsigned char priority){
+  IsosMailboxWaiter* waiter = &kernel->MailboxWaiters[taskId];
+  short* link;
+  if (waiter->Mailbox == mailbox)
+    return;
+  IsosKernel_removeMailboxWaiter(kernel, taskId);
+  for (link = &kernel->Mailboxes[mailbox].FirstWaiterId; *link >= 0 && kernel->MailboxWaiters[*link].Priority >= priority; link = &kernel->MailboxWaiters[*link].Next);
+  waiter->Next = *link;
+  waiter->Mailbox = mailbox;
+  waiter->Priority = priority;
+  *link = taskId;
 }
 
-void Isos_execute(IsosTask* task){
+//Wakes up the first receiver which is still blocked, one message is enough for one receiver only
+//The receivers which are not blocked anymore (i.e. forced to be due) are dropped, they receive again when they are run anyway
+void IsosKernel_wakeMailboxWaiter(IsosKernel* kernel, short mailbox){
+  short waiterId;
+  IsosTaskInfo* waiterInfo;
+  while ((waiterId = kernel->Mailboxes[mailbox].FirstWaiterId) >= 0){
+    IsosKernel_removeMailboxWaiter(kernel, waiterId);
+    waiterInfo = &kernel->TaskList[waiterId].Info;
+    if (waiterInfo->IsBlocked){
+      #if BASIC_DEBUG
+      IsosDebugBasic_PrintMailboxWakingNote(waiterId, mailbox);
+      #endif // BASIC_DEBUG
+      IsosKernel_wakeTask(kernel, waiterInfo);
+      return;
+    }
+  }
+}
+
+#if ISOS_TASK_STATS
+void IsosKernel_recordExecutedStats(IsosKernel* kernel, const IsosTaskInfo* taskInfo, const IsosClock* previousExecuted){
+  IsosTaskStats* stats = &kernel->TaskStats[taskInfo->Id];
+  long long jitterMs;
+  IsosHistogram_Add(&stats->DispatchLatencyMs, IsosClock_ToMs(&taskInfo->LastExecuted) - IsosClock_ToMs(&taskInfo->LastDueReported));
+  if (stats->HasExecuted && (taskInfo->Type == IsosTaskType_Repeated || taskInfo->Type == IsosTaskType_Periodic)){
+    jitterMs = IsosClock_ToMs(&taskInfo->LastExecuted) - IsosClock_ToMs(previousExecuted) - IsosClock_ToMs(&taskInfo->TimeInfo.Period);
+    IsosHistogram_Add(&stats->PeriodJitterMs, jitterMs < 0 ? -jitterMs : jitterMs); //early or late, both are jitter
+  }
+  stats->HasExecuted = 1;
+  stats->InvocationSize = 0;
+}
+
+void IsosKernel_recordFinishedStats(IsosKernel* kernel, const IsosTaskInfo* taskInfo){
+  IsosTaskStats* stats = &kernel->TaskStats[taskInfo->Id];
+  IsosHistogram_Add(&stats->RunSpanMs, IsosClock_ToMs(&taskInfo->LastFinished) - IsosClock_ToMs(&taskInfo->LastExecuted));
+  IsosHistogram_Add(&stats->InvocationsPerCompletion, stats->InvocationSize);
+  stats->InvocationSize = 0;
+}
+#endif // ISOS_TASK_STATS
+
+//Everything done before the task action is run, returns 0 if the task is not to be run at all now
+char IsosKernel_prepareExecution(IsosKernel* kernel, IsosTask* task){
   IsosClock clock;
-  IsosResourceTaskType unreleasedResourceTaskType;
-  unsigned char taskId;
   IsosTaskInfo* taskInfo;
   IsosTaskActionInfo *taskActionInfo;
   taskInfo = &task->Info;
   taskActionInfo = &taskInfo->ActionInfo;
-  taskId = taskInfo->Id;
-  //Isos_prepareGenericTaskPointersById(taskId);
-  //Disabled task, suspended, or not reported task cannot be run,
-  if (!taskActionInfo->Enabled || !taskInfo->IsDueReported)
-    return;
+  //Disabled task, suspended, blocked or not reported task cannot be run,
+  if (!taskActionInfo->Enabled || !taskInfo->IsDueReported || taskInfo->IsBlocked)
+    return 0;
 
   if (taskActionInfo->State == IsosTaskState_Suspended){ //if the task is suspended, check if the due is already coming
-    clock = Isos_GetClock();
-    clock = IsosClock_Minus(&clock, &taskInfo->SuspensionInfo.Due);
-    if (IsosClock_GetDirection(&clock) < 0){ //not due yet
+    clock = IsosKernel_GetClock(kernel);
+    if (IsosClock_Compare(&clock, &taskInfo->SuspensionInfo.Due) < 0){ //not due yet
       #if BASIC_DEBUG
       IsosDebugBasic_PrintTaskInfo(taskInfo);
       #endif // BASIC_DEBUG
-      return;
+      return 0;
     } else {
       taskActionInfo->State = IsosTaskState_Running; //change the task's state back to running
       #if BASIC_DEBUG
@@ -276,24 +671,45 @@ void Isos_execute(IsosTask* task){
   //The previous state can be initialized, failed, successful, or timeout, it does not matter! Run the task as long as it is not running but dued
   if (taskActionInfo->State != IsosTaskState_Running){ //first time, task to be re-run: Initial, Failed or Success
     taskActionInfo->State = IsosTaskState_Running; //as long as it is executed, force the state to be running
-    taskInfo->LastExecuted = Isos_GetClock(); //task to be executed for the first time
+    #if ISOS_TASK_STATS
+    clock = taskInfo->LastExecuted; //the previous execution, for the jitter
+    #endif // ISOS_TASK_STATS
+    taskInfo->LastExecuted = IsosKernel_GetClock(kernel); //task to be executed for the first time
+    IsosKernel_updateTimeoutDeadline(kernel, taskInfo); //from now on, the task is timed out by the scheduler even if it is not run again
+    #if ISOS_TASK_STATS
+    IsosKernel_recordExecutedStats(kernel, taskInfo, &clock);
+    #endif // ISOS_TASK_STATS
   }
   #if BASIC_DEBUG
   IsosDebugBasic_PrintTaskInfo(taskInfo);
   #endif // BASIC_DEBUG
 
   //Now, just before a task is executed, we will check if it is timeout
-  clock = Isos_GetClock();
+  clock = IsosKernel_GetClock(kernel);
   if (IsosTask_IsTimeout(&clock, taskInfo)){ //This is to set timeout "externally" (outside of the task) instead of "internally" (if the task change its own ActionInfo.State)
     #if BASIC_DEBUG
     IsosDebugBasic_PrintForcedTimeoutDetected(taskInfo);
     #endif // BASIC_DEBUG
     taskActionInfo->State = IsosTaskState_Timeout;
+    ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_TIMEOUT, IsosTraceEventType_Timeout, taskInfo->Id, 0, 0);
   }
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_TASK, IsosTraceEventType_Dispatch, taskInfo->Id, taskActionInfo->Subtask, taskActionInfo->State);
+  #if ISOS_TASK_STATS
+  if (taskActionInfo->State != IsosTaskState_Timeout) //the task action is to be called right after this
+    kernel->TaskStats[taskInfo->Id].InvocationSize++;
+  #endif // ISOS_TASK_STATS
+  return 1;
+}
 
-  if (taskActionInfo->State != IsosTaskState_Timeout) //can only run a task if its state is not Timeout at this point
-    task->Action(taskInfo->Id, taskActionInfo); //something will happen inside, the task state will change here
-
+//Everything done after the task action is run, the task is completed here if its state says so
+void IsosKernel_finishExecution(IsosKernel* kernel, IsosTask* task){
+  short taskId;
+  IsosTaskInfo* taskInfo;
+  IsosTaskActionInfo *taskActionInfo;
+  taskInfo = &task->Info;
+  taskActionInfo = &taskInfo->ActionInfo;
+  taskId = taskInfo->Id;
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_TASK, IsosTraceEventType_State, taskId, taskActionInfo->Subtask, taskActionInfo->State);
   if (taskActionInfo->State == IsosTaskState_Failed || //means the task has been executed
       taskActionInfo->State == IsosTaskState_Success ||
       taskActionInfo->State == IsosTaskState_Timeout){
@@ -303,266 +719,519 @@ void Isos_execute(IsosTask* task){
 
     taskActionInfo->Subtask = 0; //Run is completed, reset the subtask
     taskInfo->IsDueReported = 0; //now the flag is set down so that we can know that this can be reported again
+    IsosHeap_Remove(&kernel->TimeoutHeap, taskId); //completed, whichever way
     taskInfo->ForcedDue = 0; //whatever happen, reset the force due now flag here
-    taskInfo->LastFinished = Isos_GetClock(); //update the last time task is finished executed
+    taskInfo->LastFinished = IsosKernel_GetClock(kernel); //update the last time task is finished executed
+    #if ISOS_TASK_STATS
+    IsosKernel_recordFinishedStats(kernel, taskInfo);
+    #endif // ISOS_TASK_STATS
     if (taskInfo->Type == IsosTaskType_Resource || taskInfo->Type == IsosTaskType_NonCyclical)
       taskActionInfo->Enabled = 0; //resource task and NonCyclical tasks are always disabled after completed to prevent them to be re-run
-
-    //special case for timeout! AT MOST, there could only be ONE claimed resource task per task at any given time
+    if (taskInfo->Type == IsosTaskType_Resource)
+      IsosKernel_wakeResourceClaimer(kernel, taskId); //the claimer can check the resource task state right away
+    IsosKernel_updateNextDue(kernel, taskInfo); //cyclical task waits for its next due from now on
+    IsosKernel_dropResourceWaits(kernel, taskId); //a completed task no longer waits for any resource task
+    IsosKernel_removeEventWaiter(kernel, taskId); //nor for any event
+    IsosKernel_removeMailboxWaiter(kernel, taskId); //nor for any message
+
+    //special case for timeout! The task may still hold any number of claimed resource tasks, all of them are released at once
     //WARNING: remember this MUST BE DONE THE LAST BUT BEFORE the DEQUEUEING
-    //   because the generic pointers will be screwed up here due to Isos_ReleaseResourceTask!
+    //   because the releasing changes the claim tables and the queues!
     if (taskActionInfo->State == IsosTaskState_Timeout){
-      unreleasedResourceTaskType = Isos_getClaimedResourceTaskType(taskId);
-      if (unreleasedResourceTaskType != IsosResourceTaskType_Unspecified) //if some resource task is claimed by this task, release it
-        Isos_ReleaseResourceTask(unreleasedResourceTaskType); //force release the claimed resource task, this will be handled immediately outside
+      IsosKernel_releaseClaimedResources(kernel, taskId, 0); //force release the claimed resource tasks, this will be handled immediately outside
       //When releasing the resource task, there is no need to kill it since (1) it will be killed separately if it gets stuck and (2) other task cannot claimed a running resource task
     }
 
-    Isos_dequeueFromDue(taskId); //use the original taskId, NOT genericTaskInfo->Id
+    IsosKernel_dequeueFromDue(kernel, taskId);
     //The task result is to be treated by other tasks which wait for the run task results
   }
 }
 
-//Find the due task index within the limit of the searched elements (not necessarily going through the whole list)
-short Isos_findDueTaskIndex(unsigned char taskId, unsigned char inclusiveSearchLimit){
-  short i;
-  for (i = IsosDueTaskSize - 1; i >= inclusiveSearchLimit; --i) //searching from the end most to the search limit index
-    if (IsosDueTaskList[i].TaskId == taskId)
-      return i;
-  return -1; //cannot be found
+void IsosKernel_execute(IsosKernel* kernel, IsosTask* task){
+  if (!IsosKernel_prepareExecution(kernel, task))
+    return;
+  if (task->Info.ActionInfo.State != IsosTaskState_Timeout) //can only run a task if its state is not Timeout at this point
+    task->Action(task->Info.Id, &task->Info.ActionInfo); //something will happen inside, the task state will change here
+  IsosKernel_finishExecution(kernel, task);
 }
 
-char Isos_registerTask(IsosTaskType type, IsosResourceTaskType resourceType, char enabled, short timeInfoDay, long timeInfoMs,
-                       short timeoutDay, long timeoutMs, unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*),
+char IsosKernel_registerTask(IsosKernel* kernel, IsosTaskType type, IsosResourceTaskType resourceType, char enabled, short timeInfoDay, long timeInfoMs,
+                       short timeoutDay, long timeoutMs, unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
                        unsigned char* txBuffer, short txBufferSize, unsigned char* rxBuffer, short rxBufferSize){
   IsosTask task;
-  if (IsosTaskSize >= MAX_TASK_SIZE)
+  if (kernel->TaskSize >= kernel->TaskCapacity || IsosKernel_isOnWorkerThread(kernel))
     return 0; //cannot register a task anymore
+  if (!IsosBuffer_IsValidSize(txBufferSize) || !IsosBuffer_IsValidSize(rxBufferSize))
+    return 0; //i.e. not a power of two when BUFFER_POWER_OF_TWO is set
   IsosTask_ResetState(&task.Info);
-  Isos_initClockToNow(&task.Info);
+  IsosKernel_initClockToNow(kernel, &task.Info);
   task.Info.Type = type;
   task.Info.ActionInfo.Enabled = enabled;
   task.Info.TimeInfo.Any = IsosClock_Create(timeInfoDay, timeInfoMs); //"Any", because we don't care which one of the time info
   task.Info.Timeout = IsosClock_Create(timeoutDay, timeoutMs);
   task.Info.Priority = priority;
-  task.Info.Id = IsosTaskSize; //the Id follows whatever is the current task set size
+  task.Info.ParallelSafe = 0; //only to be set by IsosKernel_SetTaskParallelSafe
+  task.Info.IsBlocked = 0;
+  task.Info.ResourceType = IsosResourceTaskType_Unspecified;
+  task.Info.Id = kernel->TaskSize; //the Id follows whatever is the current task set size
   task.Action = taskAction;
-  if (type == IsosTaskType_Resource && resourceType >= 0 && resourceType < RESOURCE_SIZE){
-    IsosResourceTaskList[resourceType] = task.Info.Id; //resource type Id must be specially mapped to the resource task list
-    IsosBuffer_Init(&IsosResourceTaskBufferList[2*resourceType], txBuffer, txBufferSize); //Tx buffer
-    IsosBuffer_Init(&IsosResourceTaskBufferList[2*resourceType+1], rxBuffer, rxBufferSize); //Tx buffer
+  if (type == IsosTaskType_Resource){ //resource type Id must be specially mapped to the resource task list
+    if (!IsosKernel_putResource(kernel, resourceType, task.Info.Id, txBuffer, txBufferSize, rxBuffer, rxBufferSize))
+      return 0;
+    task.Info.ResourceType = resourceType; //and back, so that the completed resource task finds its claimer directly
   }
-  IsosTaskList[IsosTaskSize] = task;
-  IsosTaskSize++;
+  kernel->TaskList[kernel->TaskSize] = task;
+  kernel->ResourceWaiters[kernel->TaskSize].Next = -1;
+  kernel->ResourceWaiters[kernel->TaskSize].Type = IsosResourceTaskType_Unspecified; //not waiting for any resource task
+  kernel->FirstClaimedResources[kernel->TaskSize] = -1;
+  kernel->EventWaiters[kernel->TaskSize].Next = -1;
+  kernel->EventWaiters[kernel->TaskSize].Group = -1; //not waiting on any event group
+  kernel->MailboxWaiters[kernel->TaskSize].Next = -1;
+  kernel->MailboxWaiters[kernel->TaskSize].Mailbox = -1; //not waiting on any mailbox
+  #if ISOS_TASK_STATS
+  IsosTaskStats_Reset(&kernel->TaskStats[kernel->TaskSize]);
+  #endif // ISOS_TASK_STATS
+  kernel->TaskSize++;
+  IsosKernel_updateNextDue(kernel, &kernel->TaskList[task.Info.Id].Info);
   return 1; //successful
 }
 
-char Isos_RegisterNonCyclicalTask(char enabled, short executionDueDay, long executionDueMs, short timeoutDay, long timeoutMs,
-                                  unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*)){
-  return Isos_registerTask(IsosTaskType_NonCyclical, IsosResourceTaskType_Unspecified, enabled, executionDueDay, executionDueMs,
+char IsosKernel_RegisterNonCyclicalTask(IsosKernel* kernel, char enabled, short executionDueDay, long executionDueMs, short timeoutDay, long timeoutMs,
+                                  unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_registerTask(kernel, IsosTaskType_NonCyclical, IsosResourceTaskType_Unspecified, enabled, executionDueDay, executionDueMs,
                            timeoutDay, timeoutMs, priority, taskAction,
                            NullBuffer, 0, NullBuffer, 0);
 }
 
+//Resource types are handed out in order, the named ones (IsosResourceTaskType_Type1...) included
+IsosResourceTaskType IsosKernel_NextResourceTaskType(IsosKernel* kernel){ return kernel->ResourceSize; }
+
 //Register resource task which only has single buffer (Tx or Rx)
-char Isos_RegisterResourceTaskWithBuffer(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                                         unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*),
+char IsosKernel_RegisterResourceTaskWithBuffer(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                         unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
                                          char isTxBuffer, unsigned char* buffer, short bufferSize){
   return isTxBuffer ? //to switch between registering Tx buffer or Rx buffer
-    Isos_registerTask(IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs, priority, taskAction, buffer, bufferSize, NullBuffer, 0) :
-    Isos_registerTask(IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs, priority, taskAction, NullBuffer, 0, buffer, bufferSize);
+    IsosKernel_registerTask(kernel, IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs, priority, taskAction, buffer, bufferSize, NullBuffer, 0) :
+    IsosKernel_registerTask(kernel, IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs, priority, taskAction, NullBuffer, 0, buffer, bufferSize);
 }
 
 //Register resource task which has Tx & Rx buffers
-char Isos_RegisterResourceTaskWithBuffers(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                                          unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*),
+char IsosKernel_RegisterResourceTaskWithBuffers(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                          unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
                                           unsigned char* txBuffer, short txBufferSize, unsigned char* rxBuffer, short rxBufferSize) {
-  return Isos_registerTask(IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs,
+  return IsosKernel_registerTask(kernel, IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs,
                            priority, taskAction, txBuffer, txBufferSize, rxBuffer, rxBufferSize);
 }
 
-char Isos_RegisterResourceTask(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*)){
+char IsosKernel_RegisterResourceTask(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
   //resource task always started disabled, only to be enabled when needed to be run
-  return Isos_registerTask(IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs,
+  return IsosKernel_registerTask(kernel, IsosTaskType_Resource, resourceType, 0, 0, 0, timeoutDay, timeoutMs,
                            priority, taskAction, NullBuffer, 0, NullBuffer, 0);
 }
 
-char Isos_RegisterLooselyRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                                      unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*)){
-  return Isos_registerTask(IsosTaskType_LooselyRepeated, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
+char IsosKernel_RegisterLooselyRepeatedTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                                      unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_registerTask(kernel, IsosTaskType_LooselyRepeated, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
                            timeoutDay, timeoutMs, priority, taskAction,
                            NullBuffer, 0, NullBuffer, 0);
 }
 
-char Isos_RegisterRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*)){
-  return Isos_registerTask(IsosTaskType_Repeated, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
+char IsosKernel_RegisterRepeatedTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_registerTask(kernel, IsosTaskType_Repeated, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
                            timeoutDay, timeoutMs, priority, taskAction,
                            NullBuffer, 0, NullBuffer, 0);
 }
 
-char Isos_RegisterPeriodicTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*)){
-  return Isos_registerTask(IsosTaskType_Periodic, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
+char IsosKernel_RegisterPeriodicTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_registerTask(kernel, IsosTaskType_Periodic, IsosResourceTaskType_Unspecified, enabled, periodDay, periodMs,
                            timeoutDay, timeoutMs, priority, taskAction,
                            NullBuffer, 0, NullBuffer, 0);
 }
 
 //Function to schedule a NonCyclical task to be run sometime in the future with specified priority
-void Isos_ScheduleNonCyclicalTask(IsosTaskInfo* taskInfo, unsigned char priority, char withReset, short executionDueDay, long executionDueMs){
-  IsosClock clock;
-  if (taskInfo->Type != IsosTaskType_NonCyclical)
+void IsosKernel_ScheduleNonCyclicalTask(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset, short executionDueDay, long executionDueMs){
+  if (taskInfo->Type != IsosTaskType_NonCyclical || IsosKernel_isOnWorkerThread(kernel))
     return; //rejects to run cyclical task type
-  clock.Day = executionDueDay;
-  clock.Ms = executionDueMs;
-  Isos_commonPrepareDueNonCyclicalTask(taskInfo, priority, withReset, clock);
+  IsosKernel_commonPrepareDueNonCyclicalTask(kernel, taskInfo, priority, withReset, IsosClock_Create(executionDueDay, executionDueMs));
 }
 
 //Function to hasten the due of a non-cyclical (NonCyclical or Resource) task to be run immediately with specified priority
-void Isos_DueNonCyclicalOrResourceTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
-  if (taskInfo->Type != IsosTaskType_NonCyclical && taskInfo->Type != IsosTaskType_Resource)
+void IsosKernel_DueNonCyclicalOrResourceTaskNow(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
+  if ((taskInfo->Type != IsosTaskType_NonCyclical && taskInfo->Type != IsosTaskType_Resource) || IsosKernel_isOnWorkerThread(kernel))
     return; //rejects to run cyclical task type
-  Isos_commonPrepareDueNonCyclicalTask(taskInfo, priority, withReset, Isos_GetClock());
+  IsosKernel_commonPrepareDueNonCyclicalTask(kernel, taskInfo, priority, withReset, IsosKernel_GetClock(kernel));
 }
 
 //To force to due any task right now with specified priority, regardless of the due, using special flag
 //Use this only for special case - direct intervention for the execution
-void Isos_DueTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
-  Isos_prepareToDueTask(taskInfo, priority, withReset);
+void IsosKernel_DueTaskNow(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset){
+  if (IsosKernel_isOnWorkerThread(kernel))
+    return;
+  IsosKernel_prepareToDueTask(kernel, taskInfo, priority, withReset);
   if (taskInfo->IsDueReported) //already in the task list to run, just continue, no need to re-run
     return;
   taskInfo->ForcedDue = 1; //by passing isDue checking so that it will be due to run though the due has not come yet
+  IsosKernel_updateNextDue(kernel, taskInfo);
 }
 
-void Isos_handleLastReleasedResource(short* currentDueIndex){
-  //Because there are many variables initialized here, static could probably help to save some initialization time
-  static IsosTask* nextClaimerTask;
-  static unsigned char nextClaimerId;
-  static short nextClaimerDueTaskIndex;
-  if (LastReleasedResourceTask == IsosResourceTaskType_Unspecified)
-    return;
-  // a resource task has just been released
-  Isos_prepareGenericTaskPointersById(IsosResourceTaskList[LastReleasedResourceTask]);
-  LastReleasedResourceTask = IsosResourceTaskType_Unspecified;
-  if (!genericTaskActionInfo->Flags[0]) //no flag raised, then do not need to continue
-    return;
-  //Otherwise, there is a next claimer for this task
-  nextClaimerId = genericTaskActionInfo->Flags[1];
-  IsosTask_ClearActionFlags(genericTaskActionInfo); //clear the flags for the next cycle
-  //NOTE: Since the current due task could have been removed, the next claimer due index can as well be the same as current index
-  nextClaimerDueTaskIndex = Isos_findDueTaskIndex(nextClaimerId, *currentDueIndex); //find the next claimer on the list of already executed due tasks this turn
-  if (nextClaimerDueTaskIndex < *currentDueIndex) //means task with higher priority not found
-    return; //just return immediately
-  //Otherwise, the next claimer is due before (that is, having higher index than) the current task, but is "overlooked" by this cycle!
-  //NOTE: nextClaimerDueTaskIndex == i is a very special case, means the due is in the current index due to the previous due is done
-  if (nextClaimerDueTaskIndex > *currentDueIndex){ //means it is not directly next to the just executed task
-    nextClaimerTask = &IsosTaskList[nextClaimerId]; //1. find the next claimer task
-    Isos_removeDueTaskByIndex(nextClaimerDueTaskIndex); //2. removes that task from the original position
-    Isos_insertTaskOnDue(*currentDueIndex, &nextClaimerTask->Info, nextClaimerTask->Info.LastDueReported); //3. insert that task to the current index position, DO NOT change the due reported time
-  }
-  ++(*currentDueIndex); //simply trick the scheduler to run the next claimer immediately
-  IsosRequestSorting = 1; //Isos_insertTaskOnDue should have done this, but there is no guarantee that the if condition where the function Isos_insertTaskOnDue is called above is always true
-}
-
-void Isos_handleLastClaimedResource(short* currentDueIndex){
-  if (LastClaimedResourceTask == IsosResourceTaskType_Unspecified) //No resource claim is made
+void IsosKernel_handleLastReleasedResource(IsosKernel* kernel){
+  short nextClaimerId, type; //not static, so that several kernels can run this at the same time
+  // every resource task that has just been released (i.e. all at once on timeout) is handled
+  while ((type = kernel->FirstReleasedResource) >= 0){
+    kernel->FirstReleasedResource = kernel->Resources[type].NextReleased;
+    kernel->Resources[type].Released = 0;
+    nextClaimerId = kernel->Resources[type].ClaimerId;
+    if (nextClaimerId < 0 || !kernel->Resources[type].HandedOver) //not handed over to any waiter, then do not need to continue
+      continue;
+    //Only if the waiter has already been run (and "overlooked") in this scheduler run, it needs to be run again immediately
+    //Otherwise, it is still in the current queue and will be run in this scheduler run anyway
+    if (IsosReadyQueue_Contains(kernel->NextReadyQueue, nextClaimerId))
+      IsosKernel_runImmediately(kernel, &kernel->TaskList[nextClaimerId].Info); //DO NOT change the due reported time
+  }
+}
+
+void IsosKernel_handleLastClaimedResource(IsosKernel* kernel){
+  IsosClock clock;
+  IsosTaskInfo* taskInfo;
+  if (kernel->LastClaimedResourceTask == IsosResourceTaskType_Unspecified) //No resource claim is made
     return; //returns immediately
   //Otherwise, a resource task has just been claimed!
-  Isos_prepareGenericTaskPointersById(IsosResourceTaskList[LastClaimedResourceTask]);
-  Isos_insertTaskOnDue(*currentDueIndex, genericTaskInfo, Isos_GetClock()); //insert it to the due
-  LastClaimedResourceTask = IsosResourceTaskType_Unspecified; //claim is received
-  ++(*currentDueIndex); //trick the loop so that it will run the claimed resource task immediately
+  taskInfo = &kernel->TaskList[kernel->Resources[kernel->LastClaimedResourceTask].TaskId].Info;
+  clock = IsosKernel_GetClock(kernel);
+  IsosKernel_queueOnDueHandled(kernel, taskInfo, &clock); //report it on due
+  IsosKernel_runImmediately(kernel, taskInfo); //so that it will run the claimed resource task immediately
+  kernel->LastClaimedResourceTask = IsosResourceTaskType_Unspecified; //claim is received
 }
 
-void Isos_Run(){
-  //TODO wrap this entire function in while(1) loop when code not used for demonstration
-  //Because there are many variables initialized here, static could probably help to save some initialization time
-  static IsosClock measuredClock, clock;
-  static short initialDueTaskSize, i;
-  static IsosDueTask* dueTask;
-  measuredClock = Isos_GetClock(); //the very first measured clock right now
-  clock = IsosClock_Minus(&measuredClock, &LastSchedulerRun); //the difference between the clock now with the last time the scheduler runs
-  clock = IsosClock_Minus(&clock, &SchedulerPeriod); //check if the difference computed above surpasses the scheduler period
-  if (IsosClock_GetDirection(&clock) < 0) //the period for the scheduler to run has not come yet
+//Always done on the scheduler thread after a task is run, so that the claims and releases are handled one task at a time
+void IsosKernel_afterExecution(IsosKernel* kernel, short taskId){
+  IsosTaskInfo* taskInfo = &kernel->TaskList[taskId].Info;
+  #if ISOS_PROFILING
+  kernel->ProfileCounters.Dispatches++;
+  #endif // ISOS_PROFILING
+  //not finished, to be run again on the next scheduler run, or once its suspension is due if it is waiting (not checked on every scheduler run)
+  if (taskInfo->IsDueReported && !taskInfo->IsBlocked){
+    if (taskInfo->ActionInfo.State == IsosTaskState_Suspended)
+      IsosHeap_Put(&kernel->SleepHeap, taskId, taskInfo->SuspensionInfo.Due);
+    else
+      IsosReadyQueue_Push(kernel->NextReadyQueue, taskId, taskInfo->Priority);
+  }
+  IsosKernel_handleLastReleasedResource(kernel);
+  IsosKernel_handleLastClaimedResource(kernel);
+}
+
+#if ISOS_PARALLEL_EXECUTOR
+//The parallel-safe tasks of the current queue are taken out of it and their actions are run together on the executor,
+//before the rest of the queue is run one by one. Only the task actions run on the executor threads
+void IsosKernel_runParallelTasks(IsosKernel* kernel){
+  short priority, taskId, nextTaskId, i;
+  short taskSize = 0, runTaskSize = 0;
+  char isPrepared;
+  IsosTask* task;
+  for (priority = MAX_PRIORITY; priority >= MIN_PRIORITY; --priority) //from the highest priority, just like the tasks run one by one
+    for (taskId = kernel->CurrentReadyQueue->Heads[priority]; taskId >= 0; taskId = nextTaskId){
+      nextTaskId = kernel->ReadyQueueLinks[taskId].Next;
+      if (!kernel->TaskList[taskId].Info.ParallelSafe)
+        continue;
+      IsosReadyQueue_Remove(kernel->CurrentReadyQueue, taskId);
+      kernel->ParallelTaskIds[taskSize] = taskId;
+      taskSize++;
+    }
+  for (i = 0; i < taskSize; ++i){ //the due and the timeout are checked here, not on the executor threads
+    taskId = kernel->ParallelTaskIds[i];
+    task = &kernel->TaskList[taskId];
+    isPrepared = IsosKernel_prepareExecution(kernel, task);
+    if (isPrepared && task->Info.ActionInfo.State != IsosTaskState_Timeout){
+      kernel->ParallelTaskIds[runTaskSize] = taskId; //never ahead of i, so the tasks yet to be prepared are kept
+      runTaskSize++;
+      continue;
+    }
+    if (isPrepared) //timeout, the task is completed without running its action
+      IsosKernel_finishExecution(kernel, task);
+    IsosKernel_afterExecution(kernel, taskId);
+  }
+  IsosWorkerKernel = kernel; //the scheduler thread runs its share of the task actions alongside the worker threads, it may not change the kernel either
+  IsosExecutor_RunTasks(kernel->Executor, kernel->ParallelTaskIds, runTaskSize);
+  IsosWorkerKernel = (void*)0;
+  for (i = 0; i < runTaskSize; ++i){
+    taskId = kernel->ParallelTaskIds[i];
+    IsosKernel_finishExecution(kernel, &kernel->TaskList[taskId]);
+    IsosKernel_afterExecution(kernel, taskId);
+  }
+}
+#endif // ISOS_PARALLEL_EXECUTOR
+
+//The expired timeouts are fired on every scheduler run, whatever the tasks are doing (running, suspended, blocked or never picked from the queue)
+//Only the expired deadlines on top are checked, and the resource tasks held by the timed out tasks are released right away
+void IsosKernel_fireTimeouts(IsosKernel* kernel){
+  IsosTaskInfo* taskInfo;
+  IsosClock mainClock, deadline;
+  short taskId;
+  mainClock = IsosKernel_GetClock(kernel);
+  while (IsosHeap_Peek(&kernel->TimeoutHeap, &taskId, &deadline)){
+    if (IsosClock_Compare(&mainClock, &deadline) < 0) //the earliest deadline has not come yet, so nothing else is expired
+      break;
+    IsosHeap_Pop(&kernel->TimeoutHeap, &taskId, &deadline);
+    taskInfo = &kernel->TaskList[taskId].Info;
+    if (!taskInfo->ActionInfo.Enabled) //disabled by the "super user", it is not run anyway, it is timed out once it is enabled and run again
+      continue;
+    #if BASIC_DEBUG
+    IsosDebugBasic_PrintForcedTimeoutDetected(taskInfo);
+    #endif // BASIC_DEBUG
+    taskInfo->IsBlocked = 0; //the blocked task is completed too, it is in none of the queues, so nothing else needs to be undone
+    taskInfo->ActionInfo.State = IsosTaskState_Timeout;
+    ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_TIMEOUT, IsosTraceEventType_Timeout, taskId, 0, 0);
+    IsosKernel_finishExecution(kernel, &kernel->TaskList[taskId]);
+    IsosKernel_handleLastReleasedResource(kernel);
+  }
+}
+
+//The bits posted by the ISRs since the last run are set here, so that the tasks waiting on them are run on this scheduler run
+void IsosKernel_takePendingEvents(IsosKernel* kernel){
+  IsosEventBits bits;
+  short group;
+  if (!ISOS_EVENT_TAKE(kernel->HasPendingEvents)) //nothing has been posted, no need to look at the groups
     return;
-  Isos_scheduler();
-  LastSchedulerRun = measuredClock;
-  initialDueTaskSize = IsosDueTaskSize; //assign the value to local variable first because it is going to change in the loop
+  for (group = 0; group < kernel->EventGroupSize; ++group)
+    if ((bits = IsosEventGroup_TakePending(&kernel->EventGroups[group])) != 0)
+      IsosKernel_setGroupEvents(kernel, group, bits);
+}
 
+void IsosKernel_run(IsosKernel* kernel){
+  //The variables are not static, so that several kernels can run this at the same time
+  IsosClock measuredClock, clock;
+  short taskId;
   #if BASIC_DEBUG
-  IsosDebugBasic_PrintDueTasks(IsosDueTaskList, initialDueTaskSize);
+  short initialDueTaskSize;
   #endif // BASIC_DEBUG
-  for (i = initialDueTaskSize - 1; i >= 0; --i){
-    dueTask = &IsosDueTaskList[i];
-    Isos_execute(&IsosTaskList[dueTask->TaskId]);
-    Isos_handleLastReleasedResource(&i);
-    Isos_handleLastClaimedResource(&i);
+  IsosReadyQueue* swappedQueue;
+  #if ISOS_PROFILING
+  long long startNs;
+  #endif // ISOS_PROFILING
+  measuredClock = IsosKernel_GetClock(kernel); //the very first measured clock right now
+  clock = IsosClock_Add(&kernel->LastSchedulerRun, &kernel->SchedulerPeriod); //the next time the scheduler should run
+  if (IsosClock_Compare(&measuredClock, &clock) < 0) //the period for the scheduler to run has not come yet
+    return;
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_SCHEDULER, IsosTraceEventType_SchedulerRun, -1, 0, 0);
+  ISOS_PROFILE_START(startNs);
+  IsosKernel_takePendingEvents(kernel);
+  IsosKernel_scheduler(kernel);
+  IsosKernel_fireTimeouts(kernel);
+  ISOS_PROFILE_STOP(kernel->ProfileCounters.SchedulerNs, startNs);
+  #if ISOS_PROFILING
+  kernel->ProfileCounters.SchedulerRuns++;
+  #endif // ISOS_PROFILING
+  kernel->LastSchedulerRun = measuredClock;
+
+  #if BASIC_DEBUG
+  initialDueTaskSize = kernel->CurrentReadyQueue->Size; //assign the value to local variable first because it is going to change in the loop
+  IsosReadyQueue_Snapshot(kernel->CurrentReadyQueue, kernel->DueTaskSnapshot);
+  IsosDebugBasic_PrintDueTasks(kernel->DueTaskSnapshot, initialDueTaskSize);
+  #endif // BASIC_DEBUG
+  //every due task is run once per scheduler run, from the highest priority, until the current queue is empty
+  ISOS_PROFILE_START(startNs);
+  #if ISOS_PARALLEL_EXECUTOR
+  if (kernel->Executor){
+    ISOS_PROFILE_STOP(kernel->ProfileCounters.ReadyQueueNs, startNs);
+    ISOS_PROFILE_START(startNs);
+    IsosKernel_runParallelTasks(kernel);
+    ISOS_PROFILE_STOP(kernel->ProfileCounters.ExecuteNs, startNs);
+    ISOS_PROFILE_START(startNs);
+  }
+  #endif // ISOS_PARALLEL_EXECUTOR
+  while ((taskId = IsosKernel_takeNextTaskToRun(kernel)) >= 0){
+    ISOS_PROFILE_STOP(kernel->ProfileCounters.ReadyQueueNs, startNs);
+    ISOS_PROFILE_START(startNs);
+    IsosKernel_execute(kernel, &kernel->TaskList[taskId]);
+    ISOS_PROFILE_STOP(kernel->ProfileCounters.ExecuteNs, startNs);
+    ISOS_PROFILE_START(startNs);
+    IsosKernel_afterExecution(kernel, taskId);
   }
-  LastSchedulerFinished = Isos_GetClock(); //maybe required for debugging
+  swappedQueue = kernel->CurrentReadyQueue; //the current queue is empty by now, the unfinished tasks become the current ones
+  kernel->CurrentReadyQueue = kernel->NextReadyQueue;
+  kernel->NextReadyQueue = swappedQueue;
+  ISOS_PROFILE_STOP(kernel->ProfileCounters.ReadyQueueNs, startNs);
+  kernel->LastSchedulerFinished = IsosKernel_GetClock(kernel); //maybe required for debugging
   #if BASIC_DEBUG
   IsosDebugBasic_PrintDueTasksEnding(initialDueTaskSize);
   #endif // BASIC_DEBUG
 }
 
-void Isos_Wait(unsigned char taskId, short waitingDay, long waitingMs){
+//While the kernel runs, it is the current kernel of the thread, so that the Isos_ functions called by the task actions work on it
+void IsosKernel_Run(IsosKernel* kernel){
+  //TODO wrap this entire function in while(1) loop when code not used for demonstration
+  IsosKernel* previousKernel = IsosCurrentKernel;
+  IsosCurrentKernel = kernel;
+  IsosKernel_run(kernel);
+  IsosCurrentKernel = previousKernel;
+}
+
+void IsosKernel_Wait(IsosKernel* kernel, short taskId, short waitingDay, long waitingMs){
   IsosClock clock, addClock;
-  if (taskId < 0 || taskId >= IsosTaskSize)
+  IsosTaskInfo* taskInfo;
+  if (taskId < 0 || taskId >= kernel->TaskSize || IsosKernel_isOnWorkerThread(kernel))
     return; //such task does not exist
-  clock = Isos_GetClock();
+  clock = IsosKernel_GetClock(kernel);
   addClock = IsosClock_Create(waitingDay, waitingMs);
-  Isos_prepareGenericTaskPointersById(taskId);
-  genericTaskActionInfo->State = IsosTaskState_Suspended; //put the task state to Suspended
-  genericTaskInfo->SuspensionInfo.Due = IsosClock_Add(&clock, &addClock); //set the suspended time
+  taskInfo = &kernel->TaskList[taskId].Info;
+  taskInfo->ActionInfo.State = IsosTaskState_Suspended; //put the task state to Suspended
+  taskInfo->SuspensionInfo.Due = IsosClock_Add(&clock, &addClock); //set the suspended time
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_WAIT, IsosTraceEventType_Suspend, taskId, 0, IsosClock_ToMs(&taskInfo->SuspensionInfo.Due));
+  if (IsosHeap_Contains(&kernel->SleepHeap, taskId)) //already sleeping, the running task itself is put to sleep after its execution
+    IsosHeap_Put(&kernel->SleepHeap, taskId, taskInfo->SuspensionInfo.Due);
+  IsosKernel_updateNextDue(kernel, taskInfo); //suspended task, if it is not yet on due, should not be due
   #if BASIC_DEBUG
-  IsosDebugBasic_PrintWaitingNote(genericTaskInfo);
+  IsosDebugBasic_PrintWaitingNote(taskInfo);
   #endif // BASIC_DEBUG
 }
 
 //Generate the suspension due from suspension time already specified before
-void Isos_WaitFromSuspensionTime(unsigned char taskId){
-  if (taskId < 0 || taskId >= IsosTaskSize)
+void IsosKernel_WaitFromSuspensionTime(IsosKernel* kernel, short taskId){
+  if (taskId < 0 || taskId >= kernel->TaskSize)
     return; //such task does not exist
-  Isos_Wait(taskId, IsosTaskList[taskId].Info.SuspensionInfo.Time.Day, IsosTaskList[taskId].Info.SuspensionInfo.Time.Ms);
+  IsosKernel_Wait(kernel, taskId, IsosClock_GetDay(&kernel->TaskList[taskId].Info.SuspensionInfo.Time), IsosClock_GetMs(&kernel->TaskList[taskId].Info.SuspensionInfo.Time));
 }
 
 //Call this every 1 ms
-void Isos_Tick(){
-  IsosMainClock.Ms++;
-  if (IsosMainClock.Ms >= MS_PER_DAY){
-    IsosMainClock.Ms = 0;
-    IsosMainClock.Day++;
-  }
-}
-
-//Reminder: for resource task, Flags = Next Claimer Flag | Next Claimer Id | Next Claimer Priority | Reserved
-void Isos_putNextClaimerFlags(unsigned char* resourceTaskInfoFlags, unsigned char nextClaimerId, unsigned char nextClaimerPriority){
-  resourceTaskInfoFlags[0] = 1;
-  resourceTaskInfoFlags[1] = nextClaimerId;
-  resourceTaskInfoFlags[2] = nextClaimerPriority;
-}
-
-//1. parse the current flag to show if there is currently a next claimer, if there is not, just queue this new claimer
-//2. if there is, get the Id and priority of the competing claimer
-//3. check the priority of the current next claimer
-//4. If the new next claimer has higher priority than the current next claimer, replace the flag, otherwise, let it be
-void Isos_solveCompetingNextClaims(unsigned char* resourceTaskInfoFlags, unsigned char challengerId, unsigned char challengerPriority){
-  unsigned char hasCompetitor, currentPriority;
-  hasCompetitor = resourceTaskInfoFlags[0];
-  if (!hasCompetitor){ //no competitor, just put this as next claimer
-    Isos_putNextClaimerFlags(resourceTaskInfoFlags, challengerId, challengerPriority);
+void IsosKernel_Tick(IsosKernel* kernel){
+  IsosClock_AddMs(&kernel->MainClock, 1);
+}
+
+//Call this instead of Isos_Tick when the clock is not ticked every 1 ms (i.e. tickless), to advance the clock by the elapsed time in one step
+void IsosKernel_AdvanceClock(IsosKernel* kernel, short elapsedDay, long elapsedMs){
+  IsosClock elapsedClock;
+  elapsedClock = IsosClock_Create(elapsedDay, elapsedMs);
+  kernel->MainClock = IsosClock_Add(&kernel->MainClock, &elapsedClock);
+}
+
+void Isos_keepEarlierClock(IsosClock* earliestClock, char* hasClock, const IsosClock* clock){
+  if (*hasClock && IsosClock_Compare(clock, earliestClock) >= 0) //not earlier than the current earliest clock
     return;
+  *earliestClock = *clock;
+  *hasClock = 1;
+}
+
+//To get the earliest clock on which Isos_Run could have something to do, so that the caller can be idle (sleep) until then
+//The candidates are: the earliest task due, the earliest suspension due of the sleeping tasks, the earliest timeout deadline,
+//the due tasks still in the queue (run again on the next scheduler run), and the tasks woken up (or the events posted) since the last run
+//If there is nothing to wait for at all (no enabled task), returns 0
+char IsosKernel_GetNextDeadline(IsosKernel* kernel, IsosClock* deadline){
+  IsosClock clock, mainClock;
+  IsosTaskInfo* taskInfo;
+  short taskId, priority;
+  char hasDeadline = 0, isDueNow = 0;
+  mainClock = IsosKernel_GetClock(kernel);
+  if (IsosHeap_Peek(&kernel->NextDueHeap, &taskId, &clock))
+    Isos_keepEarlierClock(deadline, &hasDeadline, &clock);
+  if (IsosHeap_Peek(&kernel->SleepHeap, &taskId, &clock))
+    Isos_keepEarlierClock(deadline, &hasDeadline, &clock);
+  if (IsosHeap_Peek(&kernel->TimeoutHeap, &taskId, &clock))
+    Isos_keepEarlierClock(deadline, &hasDeadline, &clock);
+  if (kernel->ImmediateTaskSize > 0 || ISOS_EVENT_PEEK(kernel->HasPendingEvents)) //i.e. woken up by Isos_SetEvents outside Isos_Run
+    Isos_keepEarlierClock(deadline, &hasDeadline, &mainClock);
+  //between the scheduler runs, all the unfinished due tasks are in the current queue, the first one not suspended is due now and ends the search
+  for (priority = 0; priority < READY_QUEUE_LEVEL_SIZE && !isDueNow; ++priority)
+    for (taskId = kernel->CurrentReadyQueue->Heads[priority]; taskId >= 0 && !isDueNow; taskId = kernel->ReadyQueueLinks[taskId].Next){
+      taskInfo = &kernel->TaskList[taskId].Info;
+      isDueNow = taskInfo->ActionInfo.State != IsosTaskState_Suspended;
+      Isos_keepEarlierClock(deadline, &hasDeadline, isDueNow ? &mainClock : &taskInfo->SuspensionInfo.Due);
+    }
+  if (!hasDeadline)
+    return 0;
+  clock = IsosClock_Add(&kernel->LastSchedulerRun, &kernel->SchedulerPeriod); //whatever the deadline is, the scheduler cannot run earlier than its period
+  if (IsosClock_Compare(&clock, deadline) > 0)
+    *deadline = clock;
+  return 1;
+}
+
+//Like IsosKernel_GetNextDeadline, but rounded up to the scheduler period grid: the clock on which a 1 ms tick loop (running the OS on every tick)
+//would run the scheduler next, so that a driver jumping the clock straight there makes the same scheduling decisions as the tick loop
+char IsosKernel_GetNextTickDeadline(IsosKernel* kernel, IsosClock* deadline){
+  IsosClock clock;
+  long long periodMs, lateMs;
+  if (!IsosKernel_GetNextDeadline(kernel, deadline))
+    return 0;
+  periodMs = IsosClock_ToMs(&kernel->SchedulerPeriod);
+  clock = IsosClock_Add(&kernel->LastSchedulerRun, &kernel->SchedulerPeriod); //the deadline is never earlier than this
+  lateMs = IsosClock_ToMs(deadline) - IsosClock_ToMs(&clock);
+  if (periodMs > 0 && lateMs % periodMs != 0)
+    *deadline = IsosClock_FromMs(IsosClock_ToMs(deadline) + periodMs - lateMs % periodMs);
+  return 1;
+}
+
+#if ISOS_PROFILING
+void IsosKernel_GetProfile(IsosKernel* kernel, IsosProfile* profile){ *profile = kernel->ProfileCounters; }
+
+void IsosKernel_ResetProfile(IsosKernel* kernel){ memset(&kernel->ProfileCounters, 0, sizeof(kernel->ProfileCounters)); }
+#endif // ISOS_PROFILING
+
+#if ISOS_TASK_STATS
+char IsosKernel_GetTaskStats(IsosKernel* kernel, short taskId, IsosTaskStats* stats){
+  if (taskId < 0 || taskId >= kernel->TaskSize)
+    return 0; //such task does not exist
+  *stats = kernel->TaskStats[taskId];
+  return 1;
+}
+
+void IsosKernel_ResetTaskStats(IsosKernel* kernel, short taskId){
+  short i;
+  for (i = 0; i < kernel->TaskSize; ++i)
+    if (taskId < 0 || i == taskId)
+      IsosTaskStats_Reset(&kernel->TaskStats[i]);
+}
+#endif // ISOS_TASK_STATS
+
+#if ISOS_TRACE
+void IsosKernel_SetTrace(IsosKernel* kernel, IsosTrace* trace){ kernel->Trace = trace; }
+
+void IsosKernel_TraceStimulus(IsosKernel* kernel, unsigned char kind, int value){
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_SCHEDULER, IsosTraceEventType_Stimulus, -1, kind, value);
+}
+
+//Only the stimuli and the scheduler runs are driven here, in the recorded order and on the recorded clock, everything else must follow from them
+//Nothing must happen in between (i.e. no Isos_Tick), the kernel is driven by the trace only
+char IsosKernel_Replay(IsosKernel* kernel, IsosTrace* trace, void (*stimulusAction)(unsigned char, int)){
+  IsosTrace* previousTrace = kernel->Trace;
+  const IsosTraceEvent* event;
+  IsosClock clock;
+  long long elapsedMs;
+  long eventIndex;
+  kernel->Trace = trace;
+  while (trace->MismatchIndex < 0 && (event = IsosTrace_GetExpected(trace)) != (void*)0){
+    eventIndex = trace->Size;
+    clock = IsosKernel_GetClock(kernel);
+    elapsedMs = event->ClockMs - IsosClock_ToMs(&clock);
+    if (elapsedMs > 0)
+      IsosKernel_AdvanceClock(kernel, (short)(elapsedMs / MS_PER_DAY), (long)(elapsedMs % MS_PER_DAY));
+    if (event->Type == IsosTraceEventType_Stimulus){
+      IsosKernel_TraceStimulus(kernel, event->Detail, event->Value);
+      stimulusAction(event->Detail, event->Value);
+    } else if (event->Type == IsosTraceEventType_SchedulerRun)
+      IsosKernel_Run(kernel);
+    if (trace->Size == eventIndex) //nothing has happened, the recorded event is a decision which is not made this time
+      trace->MismatchIndex = eventIndex;
   }
-  currentPriority = resourceTaskInfoFlags[2];
-  if (challengerPriority > currentPriority) //only if the challenger is having HIGHER priority (not equal or less) than the current priority the next claimer can be changed
-    Isos_putNextClaimerFlags(resourceTaskInfoFlags, challengerId, challengerPriority);
+  kernel->Trace = previousTrace;
+  return trace->MismatchIndex < 0;
 }
+#endif // ISOS_TRACE
+
+#if ISOS_TRACE_RING
+void IsosKernel_SetTraceRing(IsosKernel* kernel, IsosTraceRing* ring){ kernel->TraceRing = ring; }
+#endif // ISOS_TRACE_RING
 
-char Isos_checkResourceTaskTypeValidity(IsosResourceTaskType type){
-  if (type < 0 || type >= RESOURCE_SIZE) {//non-existing resource type
+//The resource tasks are only used on the scheduler thread, a parallel-safe task action cannot claim them (nor use their buffers)
+char IsosKernel_checkResourceTaskTypeValidity(IsosKernel* kernel, IsosResourceTaskType type){
+  if (IsosKernel_isOnWorkerThread(kernel))
+    return 0;
+  if (type < 0 || type >= kernel->ResourceSize || kernel->Resources[type].TaskId < 0) {//non-existing resource type
     #if BASIC_DEBUG
     IsosDebugBasic_PrintResourceTaskInvalid(type);
     #endif // BASIC_DEBUG
+    ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_ResourceInvalid, -1, 0, type);
     return 0;
   }
   return 1;
@@ -573,71 +1242,123 @@ char Isos_checkResourceTaskTypeValidity(IsosResourceTaskType type){
 // (i.e. the Tx data) because the resource task is going to be immediately run!
 //WARNING: as a best practice, DO NOT claim/release more than one resource task per subtask
 //Will fail if:
-// 1. Resource task is already claimed or is running
-// 2. Resource task is neither claimed or run, but has next claimer which is both on due and has higher priority than the claimer
-//    a. If the next claimer is NOT on due, however high his priority then the current claimer will succeed AND the next claimer info will be erased
-//    b. If the next claimer is ON DUE but has EQUAL priority or LOWER, the current claimer will succeed, BUT the next claimer info will be in tact
-char Isos_ClaimResourceTask(unsigned char claimerTaskId, IsosResourceTaskType type){
+// 1. Resource task is already claimed (or handed over to another waiter) or is running
+// 2. Resource task is neither claimed or run, but its first waiter is both on due and has higher priority than the claimer
+//    a. If the first waiter is NOT on due, however high his priority then the current claimer will succeed
+//    b. If the first waiter is ON DUE but has EQUAL priority or LOWER, the current claimer will succeed, the waiter keeps its place
+//On failure, the claimer is queued as a waiter (by priority, then by arrival) unless it is already waiting for this resource task
+//On release, the resource task is handed over to the first waiter on due, whose next claim then succeeds as soon as the resource task is not running
+char IsosKernel_ClaimResourceTask(IsosKernel* kernel, short claimerTaskId, IsosResourceTaskType type){
   IsosTask *claimerTask;
-  unsigned char nextClaimerTaskId, nextClaimerTaskPriority;
-  short nextClaimerDueIndex;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  IsosTaskInfo* taskInfo;
+  short claimerId, firstWaiterId;
+  if (claimerTaskId < 0 || claimerTaskId >= kernel->TaskSize || !IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0;
-  Isos_prepareGenericTaskPointersById(IsosResourceTaskList[type]);
-  if (IsosResourceTaskClaimerList[type] != -1 || //cannot claim a task that is already claimed by someone else
-      genericTaskActionInfo->Enabled){ //cannot claim enabled,(running) resource task
+  taskInfo = &kernel->TaskList[kernel->Resources[type].TaskId].Info;
+  claimerTask = &kernel->TaskList[claimerTaskId];
+  claimerId = kernel->Resources[type].ClaimerId;
+  if (claimerId == claimerTaskId && kernel->Resources[type].HandedOver && !taskInfo->ActionInfo.Enabled)
+    kernel->Resources[type].HandedOver = 0; //the waiter takes the resource task handed over to it
+  else if (claimerId != -1 || //cannot claim a task that is already claimed by someone else
+      taskInfo->ActionInfo.Enabled){ //cannot claim enabled,(running) resource task
     #if BASIC_DEBUG
-    IsosDebugBasic_PrintResourceClaiming(type, 0, IsosResourceTaskList[type]);
+    IsosDebugBasic_PrintResourceClaiming(type, 0, kernel->Resources[type].TaskId);
     #endif // BASIC_DEBUG
-    claimerTask = &IsosTaskList[claimerTaskId];
-    Isos_solveCompetingNextClaims(genericTaskActionInfo->Flags, claimerTask->Info.Id, claimerTask->Info.Priority);
-    return 0;
-  }
-
-  //There is already a next claimer flag raised, solve the conflict nicely
-  if (genericTaskActionInfo->Flags[0]){
-    nextClaimerTaskId = genericTaskActionInfo->Flags[1];
-    nextClaimerTaskPriority = genericTaskActionInfo->Flags[2];
-    if (nextClaimerTaskId == claimerTaskId) //the rightful claimer
-      IsosTask_ClearActionFlags(genericTaskActionInfo); //prevent double claiming
-    else {
-      nextClaimerDueIndex = Isos_findDueTaskIndex(nextClaimerTaskId, IsosDueTaskSize); //check if next claimer is on due
-      if (nextClaimerDueIndex >= 0){ //if next claimer is on due
-        claimerTask = &IsosTaskList[claimerTaskId];
-        if (claimerTask->Info.Priority < nextClaimerTaskPriority){ //current claimer has lower priority than the next, due claimer, fail!
-          #if BASIC_DEBUG
-          IsosDebugBasic_PrintResourceClaiming(type, -1, IsosResourceTaskList[type]);
-          #endif // BASIC_DEBUG
-          return 0;
-        } //else successful BUT DO NOT remove the next claimer information
-      } else  //next claimer is NOT on due, clear the next claimer, whoever it is, then continue
-        IsosTask_ClearActionFlags(genericTaskActionInfo); //prevent next claimer blocking the resource task claim process
+    ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_Claim, claimerTaskId, type, 0);
+    if (claimerId != claimerTaskId) //the task handed over the resource task keeps it until the resource task stops running
+      IsosKernel_putResourceWaiter(kernel, type, claimerTaskId, claimerTask->Info.Priority);
+    return 0;
+  } else {
+    firstWaiterId = kernel->Resources[type].FirstWaiterId;
+    if (firstWaiterId >= 0 && firstWaiterId != claimerTaskId && kernel->TaskList[firstWaiterId].Info.IsDueReported &&
+        claimerTask->Info.Priority < kernel->ResourceWaiters[firstWaiterId].Priority){ //the first waiter is on due and more important, fail!
+      #if BASIC_DEBUG
+      IsosDebugBasic_PrintResourceClaiming(type, -1, kernel->Resources[type].TaskId);
+      #endif // BASIC_DEBUG
+      ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_Claim, claimerTaskId, type, -1);
+      IsosKernel_putResourceWaiter(kernel, type, claimerTaskId, claimerTask->Info.Priority);
+      return 0;
     }
+    if (kernel->ResourceWaiters[claimerTaskId].Type == type) //the waiter gets what it waits for
+      IsosKernel_removeResourceWaiter(kernel, claimerTaskId);
   }
 
-  genericTaskActionInfo->Enabled = 1; //enable the resource task for use
-  genericTaskActionInfo->Subtask = 0; //starts the resource task from subtask 0 on successful claim
-  genericTaskActionInfo->State = IsosTaskState_Initial; //reinitialize the resource task state
-  genericTaskInfo->TimeInfo.ExecutionDue = Isos_GetClock(); //execute immediately
-  LastClaimedResourceTask = type;
-  IsosResourceTaskClaimerList[type] = claimerTaskId; //set the claimer for this resource task according to its Id
+  taskInfo->ActionInfo.Enabled = 1; //enable the resource task for use
+  taskInfo->ActionInfo.Subtask = 0; //starts the resource task from subtask 0 on successful claim
+  taskInfo->ActionInfo.State = IsosTaskState_Initial; //reinitialize the resource task state
+  taskInfo->TimeInfo.ExecutionDue = IsosKernel_GetClock(kernel); //execute immediately
+  IsosKernel_updateNextDue(kernel, taskInfo);
+  kernel->LastClaimedResourceTask = type;
+  IsosKernel_setResourceClaimer(kernel, type, claimerTaskId); //set the claimer for this resource task according to its Id
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintResourceClaiming(type, 1, kernel->Resources[type].TaskId);
+  #endif // BASIC_DEBUG
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_Claim, claimerTaskId, type, 1);
+  return 1;
+}
+
+//Suspends the claimer until the resource task it has claimed completes (Success, Failed, or Timeout), instead of polling its state
+//The claimer is then run again right after the resource task, from the same subtask, and can check the resource task state
+//Returns 0 without suspending if the resource task is not claimed by the claimer or is not running, the state can be checked right away
+char IsosKernel_WaitResourceTask(IsosKernel* kernel, short claimerTaskId, IsosResourceTaskType type){
+  IsosTaskInfo* taskInfo;
+  if (claimerTaskId < 0 || claimerTaskId >= kernel->TaskSize || !IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  if (kernel->Resources[type].ClaimerId != claimerTaskId || kernel->Resources[type].HandedOver)
+    return 0; //only the claimer which has actually claimed the resource task can wait for it
+  taskInfo = &kernel->TaskList[kernel->Resources[type].TaskId].Info;
+  if (!taskInfo->ActionInfo.Enabled) //already completed
+    return 0;
+  kernel->Resources[type].Awaited = 1;
+  IsosKernel_blockTask(kernel, &kernel->TaskList[claimerTaskId].Info);
   #if BASIC_DEBUG
-  IsosDebugBasic_PrintResourceClaiming(type, 1, IsosResourceTaskList[type]);
+  IsosDebugBasic_PrintResourceWaitingNote(&kernel->TaskList[claimerTaskId].Info, type, taskInfo->Id);
   #endif // BASIC_DEBUG
   return 1;
 }
 
-char Isos_commonPrepareResourceTaskTx(IsosResourceTaskType type, unsigned char* txData, short txDataSize){
+//To go through the resource tasks claimed by (or handed over to) the task, the first one is found at once
+IsosResourceTaskType IsosKernel_GetFirstClaimedResource(IsosKernel* kernel, short taskId){
+  if (taskId < 0 || taskId >= kernel->TaskSize)
+    return IsosResourceTaskType_Unspecified;
+  return kernel->FirstClaimedResources[taskId];
+}
+
+IsosResourceTaskType IsosKernel_GetNextClaimedResource(IsosKernel* kernel, IsosResourceTaskType type){
+  if (type < 0 || type >= kernel->ResourceSize)
+    return IsosResourceTaskType_Unspecified;
+  return kernel->Resources[type].NextClaimed;
+}
+
+void IsosKernel_expectResourceTaskRxSize(IsosKernel* kernel, IsosResourceTaskType type, short expectedRxDataSize){
+  IsosBuffer* rxBuffer;
+  rxBuffer = IsosKernel_getResourceBuffer(kernel, type, 0); //gets the rx buffer
+  if (rxBuffer != &kernel->NullResourceBuffer) //the empty buffer is shared by all resource tasks having no buffer
+    rxBuffer->ExpectedDataSize = expectedRxDataSize; //sets the expected data size (return) to the Rx buffer
+}
+
+void IsosKernel_expectResourceTaskRxTime(IsosKernel* kernel, IsosResourceTaskType type, short waitRxDay, long waitRxMs){
+  IsosBuffer* rxBuffer;
+  IsosTaskInfo* taskInfo;
+  rxBuffer = IsosKernel_getResourceBuffer(kernel, type, 0); //gets the rx buffer
+  if (rxBuffer != &kernel->NullResourceBuffer)
+    rxBuffer->ExpectedDataSize = -1; //always sets expected data size to -1 for this time-case
+  taskInfo = &kernel->TaskList[kernel->Resources[type].TaskId].Info; //get the task info for this resource task
+  taskInfo->SuspensionInfo.Time = IsosClock_Create(waitRxDay, waitRxMs); //sets the suspension info time here for later consumption
+}
+
+char IsosKernel_commonPrepareResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize){
   IsosBuffer* buffer;
   char result;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0;
-  buffer = &IsosResourceTaskBufferList[2*type];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 1);
   result = IsosBuffer_Puts(buffer, txData, txDataSize);
   #if BASIC_DEBUG
   //the debug must be done AFTER Puts
   IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 2);
   #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId, IsosTraceBufferAccess_Put, IsosBuffer_GetDataSize(buffer));
   return result;
 }
 
@@ -645,58 +1366,97 @@ char Isos_commonPrepareResourceTaskTx(IsosResourceTaskType type, unsigned char*
 //Do this immediately after the claim because the resource task is going to be run immediately
 //If failed, as a good practice, the resource task is possibly supposed to be released, but this should be handled outside
 //Expected to be used for resource with Tx but without Rx
-char Isos_PrepareResourceTaskTx(IsosResourceTaskType type, unsigned char* txData, short txDataSize){
-  return Isos_commonPrepareResourceTaskTx(type, txData, txDataSize);
+char IsosKernel_PrepareResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize){
+  return IsosKernel_commonPrepareResourceTaskTx(kernel, type, txData, txDataSize);
 }
 
 //To prepare the resource task data Tx and expecting a return by data size
 //Expected to be used for resource with both Tx & Rx buffers where return data size(s) is (are) known for all cases
 //Check this very special function: IsosBuffer_HasExpectedDataSize in the isos_buffer.c to understand expectedRxDataSize
-char Isos_PrepareResourceTaskTxWithSizeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short expectedRxDataSize){
-  IsosBuffer* rxBuffer;
-  if (!Isos_commonPrepareResourceTaskTx(type, txData, txDataSize))
+char IsosKernel_PrepareResourceTaskTxWithSizeReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize, short expectedRxDataSize){
+  if (!IsosKernel_commonPrepareResourceTaskTx(kernel, type, txData, txDataSize))
     return 0;
-  rxBuffer = &IsosResourceTaskBufferList[2*type+1]; //gets the rx buffer
-  rxBuffer->ExpectedDataSize = expectedRxDataSize; //sets the expected data size (return) to the Rx buffer
+  IsosKernel_expectResourceTaskRxSize(kernel, type, expectedRxDataSize);
   return 1;
 }
 
+//To prepare the resource task data Tx and expecting one complete (length-prefixed) message in return, see IsosBuffer_PushMessage
+//Expected to be used for resource with both Tx & Rx buffers where the return is framed, so that the resource task completes once per message
+char IsosKernel_PrepareResourceTaskTxWithMessageReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize){
+  return IsosKernel_PrepareResourceTaskTxWithSizeReturn(kernel, type, txData, txDataSize, BUFFER_EXPECTED_MESSAGE);
+}
+
 //To prepare the resource task data Tx and expecting a return after some time
 //Expected to be used for resource with both Tx & Rx buffers where return data size(s) is not always known (varying)
-char Isos_PrepareResourceTaskTxWithTimeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short waitRxDay, long waitRxMs){
-  IsosBuffer* rxBuffer;
-  IsosTaskInfo* taskInfo;
-  if (!Isos_commonPrepareResourceTaskTx(type, txData, txDataSize))
+char IsosKernel_PrepareResourceTaskTxWithTimeReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize, short waitRxDay, long waitRxMs){
+  if (!IsosKernel_commonPrepareResourceTaskTx(kernel, type, txData, txDataSize))
     return 0;
-  rxBuffer = &IsosResourceTaskBufferList[2*type+1]; //gets the rx buffer
-  rxBuffer->ExpectedDataSize = -1; //always sets expected data size to -1 for this time-case
-  taskInfo = &IsosTaskList[IsosResourceTaskList[type]].Info; //get the task info for this resource task
-  taskInfo->SuspensionInfo.Time = IsosClock_Create(waitRxDay, waitRxMs); //sets the suspension info time here for later consumption
+  IsosKernel_expectResourceTaskRxTime(kernel, type, waitRxDay, waitRxMs);
+  return 1;
+}
+
+//To build the resource task data Tx in place: reserve the Tx buffer span, write the data in it, then commit the written data size
+//Use the commit functions the same way as the prepare functions, i.e. immediately after the claim
+short IsosKernel_ReserveResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, IsosBufferSpan* span, short txDataSize){
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  return IsosBuffer_ReserveWrite(IsosKernel_getResourceBuffer(kernel, type, 1), span, txDataSize);
+}
+
+char IsosKernel_CommitResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize){
+  IsosBuffer* buffer;
+  char result;
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 1);
+  result = IsosBuffer_CommitWrite(buffer, txDataSize);
+  #if BASIC_DEBUG
+  //the debug must be done AFTER the commit
+  IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 2);
+  #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId, IsosTraceBufferAccess_Put, IsosBuffer_GetDataSize(buffer));
+  return result;
+}
+
+char IsosKernel_CommitResourceTaskTxWithSizeReturn(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize, short expectedRxDataSize){
+  if (!IsosKernel_CommitResourceTaskTx(kernel, type, txDataSize))
+    return 0;
+  IsosKernel_expectResourceTaskRxSize(kernel, type, expectedRxDataSize);
   return 1;
 }
 
-IsosTaskState Isos_GetResourceTaskState(IsosResourceTaskType type){
+char IsosKernel_CommitResourceTaskTxWithTimeReturn(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize, short waitRxDay, long waitRxMs){
+  if (!IsosKernel_CommitResourceTaskTx(kernel, type, txDataSize))
+    return 0;
+  IsosKernel_expectResourceTaskRxTime(kernel, type, waitRxDay, waitRxMs);
+  return 1;
+}
+
+IsosTaskState IsosKernel_GetResourceTaskState(IsosKernel* kernel, IsosResourceTaskType type){
   IsosTaskState taskState;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0;
-  taskState = IsosTaskList[IsosResourceTaskList[type]].Info.ActionInfo.State;
+  taskState = kernel->TaskList[kernel->Resources[type].TaskId].Info.ActionInfo.State;
   #if BASIC_DEBUG
-  IsosDebugBasic_PrintResourceChecking(type, taskState, IsosResourceTaskList[type]);
+  IsosDebugBasic_PrintResourceChecking(type, taskState, kernel->Resources[type].TaskId);
   #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_ResourceCheck, kernel->Resources[type].TaskId, type, taskState);
   return taskState;
 }
 
-char Isos_commonPeekOrGetResourceTaskRx(short (*peekOrGetAction)(IsosBuffer*, unsigned char*, short),
+char IsosKernel_commonPeekOrGetResourceTaskRx(IsosKernel* kernel, short (*peekOrGetAction)(IsosBuffer*, unsigned char*, short),
                                         IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
   IsosBuffer* buffer;
   char result;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0;
-  buffer = &IsosResourceTaskBufferList[2*type+1];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 0);
   #if BASIC_DEBUG
   //the debug must be done BEFORE Peeks or Gets
   IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, peekOrGetAction == IsosBuffer_Peeks);
   #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId,
+                      peekOrGetAction == IsosBuffer_Peeks ? IsosTraceBufferAccess_Peek : IsosTraceBufferAccess_Get, IsosBuffer_GetDataSize(buffer));
   result = peekOrGetAction(buffer, rxDataBuffer, rxDataSize);
   return result;
 }
@@ -704,88 +1464,500 @@ char Isos_commonPeekOrGetResourceTaskRx(short (*peekOrGetAction)(IsosBuffer*, un
 //To peek the resource task data Rx, if there is any
 //Do this to check if resource task Rx has received expected data
 //Put rxDataSize to non-positive to get whatever available Rx data
-char Isos_PeekResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
-  return Isos_commonPeekOrGetResourceTaskRx(IsosBuffer_Peeks, type, rxDataBuffer, rxDataSize);
+char IsosKernel_PeekResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
+  return IsosKernel_commonPeekOrGetResourceTaskRx(kernel, IsosBuffer_Peeks, type, rxDataBuffer, rxDataSize);
 }
 
 //To get the resource task data Rx, if there is any
 //Do this to get the expected data from resource task Rx
 //Put rxDataSize to non-positive to get whatever available Rx data
-char Isos_GetResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
-  return Isos_commonPeekOrGetResourceTaskRx(IsosBuffer_Gets, type, rxDataBuffer, rxDataSize);
+char IsosKernel_GetResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
+  return IsosKernel_commonPeekOrGetResourceTaskRx(kernel, IsosBuffer_Gets, type, rxDataBuffer, rxDataSize);
+}
+
+//To parse the resource task data Rx in place: peek the Rx buffer span, read the data in it, then consume the read data size
+//Put rxDataSize to non-positive to peek whatever available Rx data
+short IsosKernel_PeekResourceTaskRxSpan(IsosKernel* kernel, IsosResourceTaskType type, IsosBufferSpan* span, short rxDataSize){
+  IsosBuffer* buffer;
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 0);
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 1);
+  #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId, IsosTraceBufferAccess_Peek, IsosBuffer_GetDataSize(buffer));
+  return IsosBuffer_PeekRead(buffer, span, rxDataSize);
+}
+
+char IsosKernel_ConsumeResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, short rxDataSize){
+  IsosBuffer* buffer;
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 0);
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 0);
+  #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId, IsosTraceBufferAccess_Get, IsosBuffer_GetDataSize(buffer));
+  return IsosBuffer_ConsumeRead(buffer, rxDataSize);
+}
+
+//To get the first complete message from the resource task Rx, returns its length (0 if there is none, or it is longer than rxDataSize)
+short IsosKernel_GetResourceTaskRxMessage(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){
+  IsosBuffer* buffer;
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return 0;
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 0);
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 0);
+  #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId, IsosTraceBufferAccess_Get, IsosBuffer_GetDataSize(buffer));
+  return IsosBuffer_PopMessage(buffer, rxDataBuffer, rxDataSize);
 }
 
 //Function to release a resource task, always successful
 //WARNING: as a best practice, DO NOT claim/release more than one resource task per subtask
-void Isos_ReleaseResourceTask(IsosResourceTaskType type){
-  if (type < 0 || type >= RESOURCE_SIZE) //non-existing resource type
+void IsosKernel_ReleaseResourceTask(IsosKernel* kernel, IsosResourceTaskType type){
+  if (type < 0 || type >= kernel->ResourceSize || kernel->Resources[type].TaskId < 0 || IsosKernel_isOnWorkerThread(kernel)) //non-existing resource type
     return;
   //Releasing task DOES NOT disable it, this is OK because the running resource task cannot be claimed by new task and stuck resource task at some point will be killed by the OS
-  LastReleasedResourceTask = type;
-  IsosResourceTaskClaimerList[type] = -1; //reset the claimer for this resource task back to -1
+  if (!kernel->Resources[type].Released){ //to be handled immediately outside
+    kernel->Resources[type].Released = 1;
+    kernel->Resources[type].NextReleased = kernel->FirstReleasedResource;
+    kernel->FirstReleasedResource = type;
+  }
+  IsosKernel_setResourceClaimer(kernel, type, -1); //reset the claimer for this resource task back to -1
+  kernel->Resources[type].HandedOver = 0;
+  kernel->Resources[type].Awaited = 0;
+  IsosKernel_handOverResource(kernel, type); //the first waiter on due becomes the claimer right away
+  ISOS_TRACE_EVENT(kernel, ISOS_TRACE_CATEGORY_RESOURCE, IsosTraceEventType_Release, kernel->Resources[type].TaskId, type, kernel->Resources[type].ClaimerId);
   #if BASIC_DEBUG
-  IsosDebugBasic_PrintResourceReleasing(type, IsosResourceTaskList[type]);
+  IsosDebugBasic_PrintResourceReleasing(type, kernel->Resources[type].TaskId);
   #endif // BASIC_DEBUG
 }
 
-void Isos_flushResourceTaskBuffer(IsosResourceTaskType type, char isTx){
+void IsosKernel_flushResourceTaskBuffer(IsosKernel* kernel, IsosResourceTaskType type, char isTx){
   IsosBuffer* buffer;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return;
-  buffer = &IsosResourceTaskBufferList[2*type + !isTx];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, isTx);
   IsosBuffer_Flush(buffer);
 }
 
-void Isos_FlushResourceTaskTx(IsosResourceTaskType type){ Isos_flushResourceTaskBuffer(type, 1); }
+void IsosKernel_FlushResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type){ IsosKernel_flushResourceTaskBuffer(kernel, type, 1); }
 
-void Isos_FlushResourceTaskRx(IsosResourceTaskType type){ Isos_flushResourceTaskBuffer(type, 0); }
+void IsosKernel_FlushResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type){ IsosKernel_flushResourceTaskBuffer(kernel, type, 0); }
 
-short Isos_getResourceTaskDataSize(IsosResourceTaskType type, char isTx){
+short IsosKernel_getResourceTaskDataSize(IsosKernel* kernel, IsosResourceTaskType type, char isTx){
   IsosBuffer* buffer;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0;
-  buffer = &IsosResourceTaskBufferList[2*type + !isTx];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, isTx);
   #if BASIC_DEBUG
   IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 3);
   #endif // BASIC_DEBUG
-  return buffer->DataSize;
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId,
+                      isTx ? IsosTraceBufferAccess_TxDataSize : IsosTraceBufferAccess_RxDataSize, IsosBuffer_GetDataSize(buffer));
+  return IsosBuffer_GetDataSize(buffer);
 }
 
-short Isos_GetResourceTaskTxDataSize(IsosResourceTaskType type){ return Isos_getResourceTaskDataSize(type, 1); }
+short IsosKernel_GetResourceTaskTxDataSize(IsosKernel* kernel, IsosResourceTaskType type){ return IsosKernel_getResourceTaskDataSize(kernel, type, 1); }
 
-short Isos_GetResourceTaskRxDataSize(IsosResourceTaskType type){ return Isos_getResourceTaskDataSize(type, 0); }
+short IsosKernel_GetResourceTaskRxDataSize(IsosKernel* kernel, IsosResourceTaskType type){ return IsosKernel_getResourceTaskDataSize(kernel, type, 0); }
 
-char Isos_ResourceTaskHasExpectedDataSize(IsosResourceTaskType type, char isTx){
+char IsosKernel_ResourceTaskHasExpectedDataSize(IsosKernel* kernel, IsosResourceTaskType type, char isTx){
   IsosBuffer* buffer;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0; //unsuccessful
-  buffer = &IsosResourceTaskBufferList[2*type + !isTx];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, isTx);
   #if BASIC_DEBUG
   IsosDebugBasic_PrintResourceTaskBufferData(type, buffer, 3);
   #endif // BASIC_DEBUG
+  ISOS_TRACE_RING_PUT(kernel, ISOS_TRACE_CATEGORY_BUFFER, IsosTraceEventType_Buffer, kernel->Resources[type].TaskId,
+                      isTx ? IsosTraceBufferAccess_TxDataSize : IsosTraceBufferAccess_RxDataSize, IsosBuffer_GetDataSize(buffer));
   return IsosBuffer_HasExpectedDataSize(buffer);
 }
 
-IsosBuffer* Isos_GetResourceTaskBuffer(char* result, IsosResourceTaskType type, char isTx){
+IsosBuffer* IsosKernel_GetResourceTaskBuffer(IsosKernel* kernel, char* result, IsosResourceTaskType type, char isTx){
   IsosBuffer* buffer;
   *result = 0;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return (void*)0; //unsuccessful
-  buffer = &IsosResourceTaskBufferList[2*type + !isTx];
+  buffer = IsosKernel_getResourceBuffer(kernel, type, isTx);
   if (buffer->Buffer == NullBuffer) //if the retrieved buffer is null buffer, means actually there is no buffer loaded
     return (void*)0; //unsuccessful
   *result = 1;
   return buffer;
 }
 
-char Isos_GetResourceTaskBufferFlags(IsosResourceTaskType type){
+char IsosKernel_GetResourceTaskBufferFlags(IsosKernel* kernel, IsosResourceTaskType type){
   IsosBuffer* buffer;
   char result = 0;
-  if (!Isos_checkResourceTaskTypeValidity(type))
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
     return 0; //no buffer
-  buffer = &IsosResourceTaskBufferList[2*type]; //test Tx buffer
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 1); //test Tx buffer
   result += buffer->Buffer != NullBuffer;
-  buffer = &IsosResourceTaskBufferList[2*type+1]; //test Rx buffer
+  buffer = IsosKernel_getResourceBuffer(kernel, type, 0); //test Rx buffer
   result += (buffer->Buffer != NullBuffer) << 1;
   return result;
 }
+
+//To be called when the Rx data of the resource has just come in (i.e. by the I/O backend), so that its task does not keep waiting for it
+//Only the claimed (enabled) resource task is made due, otherwise the data simply waits in the Rx buffer until it is claimed
+//If the Rx data is expected by size (or message), the task is only made due once the expected data is complete, i.e. once per message
+void IsosKernel_NotifyResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type){
+  IsosTaskInfo* taskInfo;
+  IsosBuffer* rxBuffer;
+  if (!IsosKernel_checkResourceTaskTypeValidity(kernel, type))
+    return;
+  taskInfo = &kernel->TaskList[kernel->Resources[type].TaskId].Info;
+  if (!taskInfo->ActionInfo.Enabled)
+    return;
+  rxBuffer = IsosKernel_getResourceBuffer(kernel, type, 0);
+  if (rxBuffer->ExpectedDataSize == -1) //expected by time, the task waits for the whole time anyway
+    return;
+  if (rxBuffer->ExpectedDataSize != 0 && !IsosBuffer_HasExpectedDataSize(rxBuffer))
+    return; //not complete yet, notified again with the rest of the data
+  if (taskInfo->IsBlocked){
+    IsosKernel_wakeTask(kernel, taskInfo);
+    return;
+  }
+  if (taskInfo->ActionInfo.State == IsosTaskState_Suspended){ //ends the waiting now, the task itself decides whether the Rx data is enough
+    taskInfo->SuspensionInfo.Due = IsosKernel_GetClock(kernel);
+    if (IsosHeap_Contains(&kernel->SleepHeap, taskInfo->Id))
+      IsosHeap_Put(&kernel->SleepHeap, taskInfo->Id, taskInfo->SuspensionInfo.Due); //on top, woken up on the next scheduler run
+  }
+  if (taskInfo->IsDueReported)
+    return; //already in the queue, checked on the next scheduler run
+  taskInfo->ForcedDue = 1;
+  IsosKernel_updateNextDue(kernel, taskInfo);
+}
+
+//The event group handles are given out in order, like the task Ids, up to the event group capacity given on initialization
+short IsosKernel_RegisterEventGroup(IsosKernel* kernel){
+  if (kernel->EventGroupSize >= kernel->EventGroupCapacity || IsosKernel_isOnWorkerThread(kernel))
+    return -1; //cannot register an event group anymore
+  IsosEventGroup_Init(&kernel->EventGroups[kernel->EventGroupSize]);
+  return kernel->EventGroupSize++;
+}
+
+//Only the pending bits of the group and the pending flag of the kernel are touched, both atomically, the rest is left to the next run
+void IsosKernel_SetEventsFromIsr(IsosKernel* kernel, short group, IsosEventBits bits){
+  if (group < 0 || group >= kernel->EventGroupSize)
+    return;
+  IsosEventGroup_Post(&kernel->EventGroups[group], bits);
+  ISOS_EVENT_POST(kernel->HasPendingEvents, 1); //after the bits, so that the run taking the flag also finds the bits
+  if (kernel->WakeUpAction) //after the flag, so that the woken up runner finds it
+    kernel->WakeUpAction(kernel->WakeUpArgument);
+}
+
+//The wake-up action is run on the ISR (or the other thread), so it must only signal the sleeping runner (i.e. write to an eventfd), never touch the kernel
+void IsosKernel_SetWakeUpAction(IsosKernel* kernel, void (*wakeUpAction)(void*), void* argument){
+  kernel->WakeUpArgument = argument;
+  kernel->WakeUpAction = wakeUpAction;
+}
+
+//Set on an executor worker thread, the bits are posted like from an ISR, and the waiters are woken up on the next run
+void IsosKernel_SetEvents(IsosKernel* kernel, short group, IsosEventBits bits){
+  if (group < 0 || group >= kernel->EventGroupSize)
+    return;
+  if (IsosKernel_isOnWorkerThread(kernel)){
+    IsosKernel_SetEventsFromIsr(kernel, group, bits);
+    return;
+  }
+  IsosKernel_setGroupEvents(kernel, group, bits);
+}
+
+void IsosKernel_ClearEvents(IsosKernel* kernel, short group, IsosEventBits bits){
+  if (group < 0 || group >= kernel->EventGroupSize || IsosKernel_isOnWorkerThread(kernel))
+    return;
+  kernel->EventGroups[group].Bits &= ~bits;
+}
+
+IsosEventBits IsosKernel_GetEvents(IsosKernel* kernel, short group){
+  if (group < 0 || group >= kernel->EventGroupSize)
+    return 0;
+  return kernel->EventGroups[group].Bits;
+}
+
+//The waiting task is blocked: it is in none of the queues until the bits are set, so it costs no dispatch while waiting
+//Its timeout still applies, a task timed out while waiting is taken out of the waiter list when it is completed
+char IsosKernel_WaitEvents(IsosKernel* kernel, short taskId, short group, IsosEventBits bits, char waitAll){
+  IsosEventWaiter* waiter;
+  if (taskId < 0 || taskId >= kernel->TaskSize || group < 0 || group >= kernel->EventGroupSize || bits == 0 || IsosKernel_isOnWorkerThread(kernel))
+    return 0;
+  if (IsosEventGroup_Matches(kernel->EventGroups[group].Bits, bits, waitAll)) //already set, no need to wait
+    return 0;
+  IsosKernel_removeEventWaiter(kernel, taskId); //a task waits on one event group at a time
+  waiter = &kernel->EventWaiters[taskId];
+  waiter->Next = kernel->EventGroups[group].FirstWaiterId;
+  waiter->Group = group;
+  waiter->Bits = bits;
+  waiter->WaitAll = waitAll;
+  kernel->EventGroups[group].FirstWaiterId = taskId;
+  IsosKernel_blockTask(kernel, &kernel->TaskList[taskId].Info);
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintEventWaitingNote(&kernel->TaskList[taskId].Info, group, bits, waitAll);
+  #endif // BASIC_DEBUG
+  return 1;
+}
+
+//The message pool is shared by all the mailboxes, its block size is the largest message size a mailbox can be registered with
+//Once any mailbox is registered, the pool cannot be changed anymore (returns 0)
+short IsosKernel_InitMessagePool(IsosKernel* kernel, void* memory, long memorySize, short blockSize){
+  if (kernel->MailboxSize > 0 || IsosKernel_isOnWorkerThread(kernel))
+    return 0; //the blocks may be in use
+  return IsosBlockPool_Init(&kernel->MessagePool, memory, memorySize, blockSize);
+}
+
+short IsosKernel_RegisterMailbox(IsosKernel* kernel, short messageSize, short capacity){
+  IsosMailbox* mailbox;
+  if (kernel->MailboxSize >= kernel->MailboxCapacity || IsosKernel_isOnWorkerThread(kernel))
+    return -1; //cannot register a mailbox anymore
+  if (messageSize <= 0 || messageSize > kernel->MessagePool.BlockSize || capacity < 0)
+    return -1; //the message does not fit in a block (i.e. no message pool yet)
+  mailbox = &kernel->Mailboxes[kernel->MailboxSize];
+  mailbox->MessageSize = messageSize;
+  mailbox->Capacity = capacity;
+  mailbox->Size = 0;
+  mailbox->FirstBlock = -1;
+  mailbox->LastBlock = -1;
+  mailbox->FirstWaiterId = -1;
+  return kernel->MailboxSize++;
+}
+
+char IsosKernel_PostMessage(IsosKernel* kernel, short mailbox, const void* message){
+  IsosMailbox* box;
+  short block;
+  if (mailbox < 0 || mailbox >= kernel->MailboxSize || IsosKernel_isOnWorkerThread(kernel))
+    return 0;
+  box = &kernel->Mailboxes[mailbox];
+  if (box->Capacity > 0 && box->Size >= box->Capacity)
+    return 0; //full
+  if ((block = IsosBlockPool_Take(&kernel->MessagePool)) < 0)
+    return 0; //the message pool is exhausted
+  memcpy(IsosBlockPool_GetBlock(&kernel->MessagePool, block), message, box->MessageSize);
+  if (box->LastBlock >= 0)
+    IsosBlockPool_SetNext(&kernel->MessagePool, box->LastBlock, block);
+  else
+    box->FirstBlock = block;
+  box->LastBlock = block;
+  box->Size++;
+  IsosKernel_wakeMailboxWaiter(kernel, mailbox);
+  return 1;
+}
+
+//The receiving task is blocked on an empty mailbox: it is in none of the queues until a message is posted, so it costs no dispatch while waiting
+//Its timeout still applies, a task timed out while waiting is taken out of the receiver queue when it is completed
+char IsosKernel_ReceiveMessage(IsosKernel* kernel, short taskId, short mailbox, void* message){
+  IsosMailbox* box;
+  short block;
+  if (mailbox < 0 || mailbox >= kernel->MailboxSize || taskId < -1 || taskId >= kernel->TaskSize || IsosKernel_isOnWorkerThread(kernel))
+    return 0;
+  box = &kernel->Mailboxes[mailbox];
+  if ((block = box->FirstBlock) >= 0){
+    memcpy(message, IsosBlockPool_GetBlock(&kernel->MessagePool, block), box->MessageSize);
+    box->FirstBlock = IsosBlockPool_GetNext(&kernel->MessagePool, block);
+    if (box->FirstBlock < 0)
+      box->LastBlock = -1;
+    box->Size--;
+    IsosBlockPool_Give(&kernel->MessagePool, block);
+    if (taskId >= 0)
+      IsosKernel_removeMailboxWaiter(kernel, taskId); //in case it has been forced to be due while waiting
+    return 1;
+  }
+  if (taskId < 0) //only takes, nothing to take
+    return 0;
+  IsosKernel_putMailboxWaiter(kernel, mailbox, taskId, kernel->TaskList[taskId].Info.Priority);
+  IsosKernel_blockTask(kernel, &kernel->TaskList[taskId].Info);
+  #if BASIC_DEBUG
+  IsosDebugBasic_PrintMailboxWaitingNote(&kernel->TaskList[taskId].Info, mailbox);
+  #endif // BASIC_DEBUG
+  return 0;
+}
+
+short IsosKernel_GetMailboxSize(IsosKernel* kernel, short mailbox){
+  if (mailbox < 0 || mailbox >= kernel->MailboxSize)
+    return 0;
+  return kernel->Mailboxes[mailbox].Size;
+}
+
+//Isos_ functions, working on the current kernel of the calling thread
+
+void Isos_Init(){ IsosKernel_InitWithArena(&IsosDefaultKernel, IsosDefaultArena, sizeof(IsosDefaultArena), MAX_RESOURCE_SIZE, MAX_EVENT_GROUP_SIZE, MAX_MAILBOX_SIZE); }
+
+char Isos_InitWithArena(void* arena, long arenaSize, short resourceCapacity, short eventGroupCapacity, short mailboxCapacity){ return IsosKernel_InitWithArena(IsosCurrentKernel, arena, arenaSize, resourceCapacity, eventGroupCapacity, mailboxCapacity); }
+
+IsosClock Isos_GetClock(){ return IsosKernel_GetClock(IsosCurrentKernel); }
+
+unsigned char Isos_GetTaskFlags(short taskId, unsigned char flagNo){ return IsosKernel_GetTaskFlags(IsosCurrentKernel, taskId, flagNo); }
+
+IsosTask* Isos_GetTask(short taskId){ return IsosKernel_GetTask(IsosCurrentKernel, taskId); }
+
+short Isos_GetTaskSize(){ return IsosKernel_GetTaskSize(IsosCurrentKernel); }
+
+short Isos_GetTaskCapacity(){ return IsosKernel_GetTaskCapacity(IsosCurrentKernel); }
+
+void Isos_SetTaskTimeout(short taskId, short timeoutDay, long timeoutMs){ IsosKernel_SetTaskTimeout(IsosCurrentKernel, taskId, timeoutDay, timeoutMs); }
+
+void Isos_SetTaskEnabled(short taskId, char enabled){ IsosKernel_SetTaskEnabled(IsosCurrentKernel, taskId, enabled); }
+
+char Isos_SetTaskParallelSafe(short taskId, char parallelSafe){ return IsosKernel_SetTaskParallelSafe(IsosCurrentKernel, taskId, parallelSafe); }
+
+char Isos_RegisterNonCyclicalTask(char enabled, short executionDueDay, long executionDueMs, short timeoutDay, long timeoutMs,
+                              unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_RegisterNonCyclicalTask(IsosCurrentKernel, enabled, executionDueDay, executionDueMs, timeoutDay, timeoutMs, priority, taskAction);
+}
+
+IsosResourceTaskType Isos_NextResourceTaskType(){ return IsosKernel_NextResourceTaskType(IsosCurrentKernel); }
+
+char Isos_RegisterResourceTaskWithBuffers(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                          unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
+                                          unsigned char* txBuffer, short txBufferSize, unsigned char* rxBuffer, short rxBufferSize){
+  return IsosKernel_RegisterResourceTaskWithBuffers(IsosCurrentKernel, resourceType, timeoutDay, timeoutMs, priority, taskAction, txBuffer, txBufferSize, rxBuffer, rxBufferSize);
+}
+
+char Isos_RegisterResourceTaskWithBuffer(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                         unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
+                                         char isTxBuffer, unsigned char* buffer, short bufferSize){
+  return IsosKernel_RegisterResourceTaskWithBuffer(IsosCurrentKernel, resourceType, timeoutDay, timeoutMs, priority, taskAction, isTxBuffer, buffer, bufferSize);
+}
+
+char Isos_RegisterResourceTask(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_RegisterResourceTask(IsosCurrentKernel, resourceType, timeoutDay, timeoutMs, priority, taskAction);
+}
+
+char Isos_RegisterLooselyRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                                      unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_RegisterLooselyRepeatedTask(IsosCurrentKernel, enabled, periodDay, periodMs, timeoutDay, timeoutMs, priority, taskAction);
+}
+
+char Isos_RegisterRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_RegisterRepeatedTask(IsosCurrentKernel, enabled, periodDay, periodMs, timeoutDay, timeoutMs, priority, taskAction);
+}
+
+char Isos_RegisterPeriodicTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*)){
+  return IsosKernel_RegisterPeriodicTask(IsosCurrentKernel, enabled, periodDay, periodMs, timeoutDay, timeoutMs, priority, taskAction);
+}
+
+void Isos_ScheduleNonCyclicalTask(IsosTaskInfo* taskInfo, unsigned char priority, char withReset, short executionDueDay, long executionDueMs){ IsosKernel_ScheduleNonCyclicalTask(IsosCurrentKernel, taskInfo, priority, withReset, executionDueDay, executionDueMs); }
+
+void Isos_DueNonCyclicalOrResourceTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset){ IsosKernel_DueNonCyclicalOrResourceTaskNow(IsosCurrentKernel, taskInfo, priority, withReset); }
+
+void Isos_DueTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset){ IsosKernel_DueTaskNow(IsosCurrentKernel, taskInfo, priority, withReset); }
+
+void Isos_Run(){ IsosKernel_Run(IsosCurrentKernel); }
+
+void Isos_Wait(short taskId, short waitingDay, long waitingMs){ IsosKernel_Wait(IsosCurrentKernel, taskId, waitingDay, waitingMs); }
+
+void Isos_WaitFromSuspensionTime(short taskId){ IsosKernel_WaitFromSuspensionTime(IsosCurrentKernel, taskId); }
+
+void Isos_Tick(){ IsosKernel_Tick(IsosCurrentKernel); }
+
+void Isos_AdvanceClock(short elapsedDay, long elapsedMs){ IsosKernel_AdvanceClock(IsosCurrentKernel, elapsedDay, elapsedMs); }
+
+char Isos_GetNextDeadline(IsosClock* deadline){ return IsosKernel_GetNextDeadline(IsosCurrentKernel, deadline); }
+
+char Isos_GetNextTickDeadline(IsosClock* deadline){ return IsosKernel_GetNextTickDeadline(IsosCurrentKernel, deadline); }
+
+#if ISOS_PROFILING
+void Isos_GetProfile(IsosProfile* profile){ IsosKernel_GetProfile(IsosCurrentKernel, profile); }
+
+void Isos_ResetProfile(){ IsosKernel_ResetProfile(IsosCurrentKernel); }
+#endif // ISOS_PROFILING
+
+#if ISOS_TASK_STATS
+char Isos_GetTaskStats(short taskId, IsosTaskStats* stats){ return IsosKernel_GetTaskStats(IsosCurrentKernel, taskId, stats); }
+
+void Isos_ResetTaskStats(short taskId){ IsosKernel_ResetTaskStats(IsosCurrentKernel, taskId); }
+#endif // ISOS_TASK_STATS
+
+#if ISOS_TRACE
+void Isos_SetTrace(IsosTrace* trace){ IsosKernel_SetTrace(IsosCurrentKernel, trace); }
+
+void Isos_TraceStimulus(unsigned char kind, int value){ IsosKernel_TraceStimulus(IsosCurrentKernel, kind, value); }
+
+char Isos_Replay(IsosTrace* trace, void (*stimulusAction)(unsigned char, int)){ return IsosKernel_Replay(IsosCurrentKernel, trace, stimulusAction); }
+#endif // ISOS_TRACE
+
+#if ISOS_TRACE_RING
+void Isos_SetTraceRing(IsosTraceRing* ring){ IsosKernel_SetTraceRing(IsosCurrentKernel, ring); }
+#endif // ISOS_TRACE_RING
+
+char Isos_ClaimResourceTask(short claimerTaskId, IsosResourceTaskType type){ return IsosKernel_ClaimResourceTask(IsosCurrentKernel, claimerTaskId, type); }
+
+char Isos_WaitResourceTask(short claimerTaskId, IsosResourceTaskType type){ return IsosKernel_WaitResourceTask(IsosCurrentKernel, claimerTaskId, type); }
+
+IsosResourceTaskType Isos_GetFirstClaimedResource(short taskId){ return IsosKernel_GetFirstClaimedResource(IsosCurrentKernel, taskId); }
+
+IsosResourceTaskType Isos_GetNextClaimedResource(IsosResourceTaskType type){ return IsosKernel_GetNextClaimedResource(IsosCurrentKernel, type); }
+
+char Isos_PrepareResourceTaskTx(IsosResourceTaskType type, unsigned char* txData, short txDataSize){ return IsosKernel_PrepareResourceTaskTx(IsosCurrentKernel, type, txData, txDataSize); }
+
+char Isos_PrepareResourceTaskTxWithSizeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short expectedRxDataSize){ return IsosKernel_PrepareResourceTaskTxWithSizeReturn(IsosCurrentKernel, type, txData, txDataSize, expectedRxDataSize); }
+
+char Isos_PrepareResourceTaskTxWithMessageReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize){ return IsosKernel_PrepareResourceTaskTxWithMessageReturn(IsosCurrentKernel, type, txData, txDataSize); }
+
+char Isos_PrepareResourceTaskTxWithTimeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short waitRxDay, long waitRxMs){ return IsosKernel_PrepareResourceTaskTxWithTimeReturn(IsosCurrentKernel, type, txData, txDataSize, waitRxDay, waitRxMs); }
+
+short Isos_ReserveResourceTaskTx(IsosResourceTaskType type, IsosBufferSpan* span, short txDataSize){ return IsosKernel_ReserveResourceTaskTx(IsosCurrentKernel, type, span, txDataSize); }
+
+char Isos_CommitResourceTaskTx(IsosResourceTaskType type, short txDataSize){ return IsosKernel_CommitResourceTaskTx(IsosCurrentKernel, type, txDataSize); }
+
+char Isos_CommitResourceTaskTxWithSizeReturn(IsosResourceTaskType type, short txDataSize, short expectedRxDataSize){ return IsosKernel_CommitResourceTaskTxWithSizeReturn(IsosCurrentKernel, type, txDataSize, expectedRxDataSize); }
+
+char Isos_CommitResourceTaskTxWithTimeReturn(IsosResourceTaskType type, short txDataSize, short waitRxDay, long waitRxMs){ return IsosKernel_CommitResourceTaskTxWithTimeReturn(IsosCurrentKernel, type, txDataSize, waitRxDay, waitRxMs); }
+
+IsosTaskState Isos_GetResourceTaskState(IsosResourceTaskType type){ return IsosKernel_GetResourceTaskState(IsosCurrentKernel, type); }
+
+char Isos_PeekResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){ return IsosKernel_PeekResourceTaskRx(IsosCurrentKernel, type, rxDataBuffer, rxDataSize); }
+
+char Isos_GetResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){ return IsosKernel_GetResourceTaskRx(IsosCurrentKernel, type, rxDataBuffer, rxDataSize); }
+
+short Isos_PeekResourceTaskRxSpan(IsosResourceTaskType type, IsosBufferSpan* span, short rxDataSize){ return IsosKernel_PeekResourceTaskRxSpan(IsosCurrentKernel, type, span, rxDataSize); }
+
+char Isos_ConsumeResourceTaskRx(IsosResourceTaskType type, short rxDataSize){ return IsosKernel_ConsumeResourceTaskRx(IsosCurrentKernel, type, rxDataSize); }
+
+short Isos_GetResourceTaskRxMessage(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize){ return IsosKernel_GetResourceTaskRxMessage(IsosCurrentKernel, type, rxDataBuffer, rxDataSize); }
+
+void Isos_ReleaseResourceTask(IsosResourceTaskType type){ IsosKernel_ReleaseResourceTask(IsosCurrentKernel, type); }
+
+void Isos_FlushResourceTaskTx(IsosResourceTaskType type){ IsosKernel_FlushResourceTaskTx(IsosCurrentKernel, type); }
+
+void Isos_FlushResourceTaskRx(IsosResourceTaskType type){ IsosKernel_FlushResourceTaskRx(IsosCurrentKernel, type); }
+
+short Isos_GetResourceTaskTxDataSize(IsosResourceTaskType type){ return IsosKernel_GetResourceTaskTxDataSize(IsosCurrentKernel, type); }
+
+short Isos_GetResourceTaskRxDataSize(IsosResourceTaskType type){ return IsosKernel_GetResourceTaskRxDataSize(IsosCurrentKernel, type); }
+
+char Isos_ResourceTaskHasExpectedDataSize(IsosResourceTaskType type, char isTx){ return IsosKernel_ResourceTaskHasExpectedDataSize(IsosCurrentKernel, type, isTx); }
+
+IsosBuffer* Isos_GetResourceTaskBuffer(char* result, IsosResourceTaskType type, char isTx){ return IsosKernel_GetResourceTaskBuffer(IsosCurrentKernel, result, type, isTx); }
+
+char Isos_GetResourceTaskBufferFlags(IsosResourceTaskType type){ return IsosKernel_GetResourceTaskBufferFlags(IsosCurrentKernel, type); }
+
+void Isos_NotifyResourceTaskRx(IsosResourceTaskType type){ IsosKernel_NotifyResourceTaskRx(IsosCurrentKernel, type); }
+
+short Isos_RegisterEventGroup(){ return IsosKernel_RegisterEventGroup(IsosCurrentKernel); }
+
+void Isos_SetEvents(short group, IsosEventBits bits){ IsosKernel_SetEvents(IsosCurrentKernel, group, bits); }
+
+void Isos_SetEventsFromIsr(short group, IsosEventBits bits){ IsosKernel_SetEventsFromIsr(IsosCurrentKernel, group, bits); }
+
+void Isos_ClearEvents(short group, IsosEventBits bits){ IsosKernel_ClearEvents(IsosCurrentKernel, group, bits); }
+
+IsosEventBits Isos_GetEvents(short group){ return IsosKernel_GetEvents(IsosCurrentKernel, group); }
+
+char Isos_WaitEvents(short taskId, short group, IsosEventBits bits, char waitAll){ return IsosKernel_WaitEvents(IsosCurrentKernel, taskId, group, bits, waitAll); }
+
+short Isos_InitMessagePool(void* memory, long memorySize, short blockSize){ return IsosKernel_InitMessagePool(IsosCurrentKernel, memory, memorySize, blockSize); }
+
+short Isos_RegisterMailbox(short messageSize, short capacity){ return IsosKernel_RegisterMailbox(IsosCurrentKernel, messageSize, capacity); }
+
+char Isos_PostMessage(short mailbox, const void* message){ return IsosKernel_PostMessage(IsosCurrentKernel, mailbox, message); }
+
+char Isos_ReceiveMessage(short taskId, short mailbox, void* message){ return IsosKernel_ReceiveMessage(IsosCurrentKernel, taskId, mailbox, message); }
+
+short Isos_GetMailboxSize(short mailbox){ return IsosKernel_GetMailboxSize(IsosCurrentKernel, mailbox); }
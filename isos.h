@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -29,9 +29,12 @@
 
   isos.c, isos.h
   - The main files of the ISOS
-  - Provide all internal variables used in the ISOS (main clock, scheduler period, task/resource task/due lists, etc)
+  - Provide the kernel context (IsosKernel) holding all the state of one OS instance (main clock, scheduler period, task/resource task/due lists, etc)
   - Provide all major OS related functions (task registration, scheduler, task execution, OS running, clock ticking, etc)
+    on a given kernel (IsosKernel_ functions), so that several kernels can run in parallel
   - Provide supporting functions to use in the task implementation (get main clock time, get task flags, claim/release resources, etc)
+  - Provide the Isos_ functions working on the current kernel of the thread (the default kernel unless changed)
+  - Optionally, run the actions of the parallel-safe tasks of each scheduler run on the threads of an executor (isos_executor.c)
 */
 
 #ifndef ISOS_H
@@ -39,8 +42,18 @@
 
 #include "isos_task.h"
 #include "isos_buffer.h"
+#include "isos_ready_queue.h"
+#include "isos_heap.h"
+#include "isos_event_group.h"
+#include "isos_block_pool.h"
+#include "isos_profile.h"
+#include "isos_stats.h"
+#include "isos_trace.h"
+#include "isos_trace_ring.h"
 
 //To tell the OS about the resource task type being stored, used for mapping it to the task id
+//The named types are only for convenience, any type from 0 to below the resource capacity given to IsosKernel_InitWithArena (MAX_RESOURCE_SIZE by default)
+//can be registered (see Isos_NextResourceTaskType)
 typedef enum IsosResourceTaskTypeEnum {
   IsosResourceTaskType_Unspecified = -1,
   IsosResourceTaskType_Type1 = 0,
@@ -55,59 +68,357 @@ typedef enum IsosResourceTaskTypeEnum {
 
 typedef struct IsosTaskStruct {
   IsosTaskInfo Info;
-  void (*Action)(unsigned char, IsosTaskActionInfo*);
+  void (*Action)(short, IsosTaskActionInfo*);
 } IsosTask;
 
-typedef struct IsosDueTaskStruct {
-  short TaskId; //the task index of the due task
-  unsigned char Priority; //the task priority of the due task
-} IsosDueTask;
+//The link of a task in the waiter queue of a resource task, the queue is ordered by priority, then by arrival
+typedef struct IsosResourceWaiterStruct {
+  short Next; //the next waiter of the same resource task, -1 if this is the last one
+  IsosResourceTaskType Type; //the resource task waited for, IsosResourceTaskType_Unspecified if not waiting
+  unsigned char Priority; //the priority of the waiter when it claims
+} IsosResourceWaiter;
+
+//The link of a task in the waiter list of an event group, a task waits on one event group at a time
+typedef struct IsosEventWaiterStruct {
+  short Next; //the next waiter of the same event group, -1 if this is the last one
+  short Group; //the event group waited on, -1 if not waiting
+  IsosEventBits Bits; //the bits waited for
+  char WaitAll; //all the bits must be set, otherwise any of them
+} IsosEventWaiter;
+
+//One entry of the mailbox table, the messages are the blocks taken from the message pool, queued in the order they are posted
+typedef struct IsosMailboxStruct {
+  short MessageSize; //every message of the mailbox has this size, it cannot be larger than the block size of the message pool
+  short Capacity; //the most messages queued at once, 0 if only limited by the message pool
+  short Size; //the number of messages queued
+  short FirstBlock; //the oldest message, -1 if the mailbox is empty
+  short LastBlock; //the newest message, -1 if the mailbox is empty
+  short FirstWaiterId; //the first task waiting for a message, -1 if there is none
+} IsosMailbox;
+
+//The link of a task in the receiver queue of a mailbox, the queue is ordered by priority, then by arrival
+typedef struct IsosMailboxWaiterStruct {
+  short Next; //the next receiver of the same mailbox, -1 if this is the last one
+  short Mailbox; //the mailbox waited on, -1 if not waiting
+  unsigned char Priority; //the priority of the receiver when it waits
+} IsosMailboxWaiter;
+
+//One entry of the resource table, the resource type is the index (handle) of its entry
+typedef struct IsosResourceStruct {
+  short TaskId; //the resource task, -1 if the resource type is not registered
+  short ClaimerId; //the current claimer (or the waiter it is handed over to), -1 if there is none
+  short FirstWaiterId; //the first task of the waiter queue, -1 if there is none
+  short BufferIndex; //the Tx buffer in the resource buffers (2 * the resource type), followed by the Rx buffer, -1 if the resource task has no buffer
+  short NextClaimed; //the next resource claimed by the same claimer, -1 if this is the last one
+  short NextReleased; //the next resource which has just been released, -1 if this is the last one
+  char HandedOver; //the resource task is handed over to its claimer on release, but not yet claimed by it
+  char Awaited; //the claimer is blocked until the resource task completes
+  char Released; //the resource is in the list of the just released resources
+} IsosResource;
+
+//The task storage of the OS is taken from an arena given on initialization, so that the task capacity is a runtime choice
+//The arena must be aligned for long long (i.e. declared as long long[]) and ISOS_ARENA_SIZE(taskCapacity, resourceCapacity, eventGroupCapacity, mailboxCapacity) bytes long
+//The resource, event group and mailbox tables are sized by their own capacities, the task capacity is whatever is left for the per-task arrays
+#define ISOS_ARENA_ALIGNMENT sizeof(long long)
+#if ISOS_TASK_STATS
+#define ISOS_ARENA_STATS_SECTION_SIZE 1
+#define ISOS_ARENA_STATS_BYTES_PER_TASK sizeof(IsosTaskStats)
+#else
+#define ISOS_ARENA_STATS_SECTION_SIZE 0
+#define ISOS_ARENA_STATS_BYTES_PER_TASK 0
+#endif // ISOS_TASK_STATS
+#define ISOS_ARENA_SECTION_SIZE (18 + ISOS_ARENA_STATS_SECTION_SIZE) //the number of per-task arrays taken from the arena, each one may need up to ISOS_ARENA_ALIGNMENT - 1 padding bytes
+#define ISOS_ARENA_BYTES_PER_TASK (sizeof(IsosTask) + sizeof(IsosReadyQueueLink) + 3 * (sizeof(IsosHeapItem) + sizeof(short)) + sizeof(IsosDueTask) + sizeof(short) + \
+                                   sizeof(IsosResourceWaiter) + sizeof(short) + \
+                                   sizeof(IsosEventWaiter) + sizeof(IsosMailboxWaiter) + ISOS_ARENA_STATS_BYTES_PER_TASK)
+#define ISOS_ARENA_BYTES_PER_RESOURCE (sizeof(IsosResource) + 2 * sizeof(IsosBuffer)) //the entry and its Tx and Rx buffers
+#define ISOS_ARENA_SIZE(taskCapacity, resourceCapacity, eventGroupCapacity, mailboxCapacity) ((taskCapacity) * ISOS_ARENA_BYTES_PER_TASK + \
+  (resourceCapacity) * ISOS_ARENA_BYTES_PER_RESOURCE + (eventGroupCapacity) * sizeof(IsosEventGroup) + (mailboxCapacity) * sizeof(IsosMailbox) + \
+  ISOS_ARENA_SECTION_SIZE * ISOS_ARENA_ALIGNMENT)
+#define ISOS_MAX_TASK_CAPACITY 32767 //the largest task Id must fit in a short
+
+#define IMMEDIATE_TASK_SIZE 4 //at most, a just claimed resource task and the waiter handed a just released resource task are to be run immediately
+
+//The Isos_ functions work on the current kernel of the calling thread, this needs a thread-local variable when there are threads
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define ISOS_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define ISOS_THREAD_LOCAL __thread
+#else
+#define ISOS_THREAD_LOCAL //no threads, there is only one current kernel
+#endif
+
+#ifndef ISOS_PARALLEL_EXECUTOR
+#if defined(__linux__)
+#define ISOS_PARALLEL_EXECUTOR 1 //the executor needs POSIX threads, may be set from the build (i.e. to 0 to leave it out)
+#else
+#define ISOS_PARALLEL_EXECUTOR 0
+#endif
+#endif // ISOS_PARALLEL_EXECUTOR
+
+struct IsosExecutorStruct;
+
+//All the state of one OS instance (kernel), so that several kernels can run in one program, i.e. one per core
+//The fields shouldn't be used outside isos.c, use the IsosKernel_ (or the Isos_) functions instead
+typedef struct IsosKernelStruct {
+  IsosClock MainClock; //The main clock used for the whole kernel
+  IsosClock LastSchedulerRun; //used to track when the last time the scheduler run
+  IsosClock LastSchedulerFinished; //unused in the program actually, probably good for debugging
+  IsosClock SchedulerPeriod; //used to calculate when the next time the scheduler should be run again
+  IsosTask* TaskList; //taken from the arena, like all the other per-task arrays below
+  short TaskCapacity;
+  short TaskSize;
+  IsosReadyQueue ReadyQueues[2]; //the due tasks, the two queues are swapped on every scheduler run
+  IsosReadyQueueLink* ReadyQueueLinks;
+  IsosReadyQueue* CurrentReadyQueue; //due tasks which are yet to be run on this scheduler run
+  IsosReadyQueue* NextReadyQueue; //due tasks which have been run on this scheduler run, to be run again on the next one
+  short ImmediateTaskIds[IMMEDIATE_TASK_SIZE]; //tasks to be run right away, before anything in the current queue (last in, first run)
+  short ImmediateTaskSize;
+  IsosHeap NextDueHeap; //the next-due index: enabled tasks waiting for their due, the earliest due on top
+  IsosHeap SleepHeap; //the sleep queue: due tasks suspended by Isos_Wait, out of the ready queues until their suspension due, the earliest on top
+  IsosHeap TimeoutHeap; //the timeout deadlines: started tasks with a timeout, keyed by LastExecuted + Timeout, the earliest on top
+  IsosDueTask* DueTaskSnapshot; //only to print the due tasks
+  short* ParallelTaskIds; //the parallel-safe tasks taken from the current queue, to be run together on the executor
+  struct IsosExecutorStruct* Executor; //runs the parallel-safe tasks, null to run all tasks one by one on the calling thread
+  IsosResource* Resources; //the resource table, indexed by the resource type
+  short ResourceCapacity; //the resource types from 0 to ResourceCapacity - 1 can be registered
+  short ResourceSize; //the resource types from this one on are not registered yet
+  IsosBuffer* ResourceBuffers; //the Tx and Rx buffers of every resource type, only used by the resource tasks having any buffer
+  IsosBuffer NullResourceBuffer; //stands for the buffers of the resource tasks having no buffer
+  IsosResourceWaiter* ResourceWaiters; //the waiter queue links of all tasks, indexed by the task Id
+  short* FirstClaimedResources; //the first resource claimed by (or handed over to) every task, -1 if there is none, indexed by the task Id
+  IsosResourceTaskType LastClaimedResourceTask; //Used as a flag if there is any resource task that has just been claimed
+  short FirstReleasedResource; //the resource tasks that have just been released, -1 if there is none
+  IsosEventGroup* EventGroups; //the event group table, indexed by the event group handle
+  short EventGroupCapacity;
+  short EventGroupSize; //the event groups from this one on are not registered yet
+  IsosEventWaiter* EventWaiters; //the event group waiter links of all tasks, indexed by the task Id
+  IsosPendingEventBits HasPendingEvents; //any event group has pending bits posted by an ISR, to be taken in on the next run
+  void (*WakeUpAction)(void*); //run after the bits are posted by an ISR, null if nothing waits for them (i.e. the clock is ticked in a loop)
+  void* WakeUpArgument;
+  IsosBlockPool MessagePool; //shared by all the mailboxes, empty until IsosKernel_InitMessagePool
+  IsosMailbox* Mailboxes; //the mailbox table, indexed by the mailbox handle
+  short MailboxCapacity;
+  short MailboxSize; //the mailboxes from this one on are not registered yet
+  IsosMailboxWaiter* MailboxWaiters; //the receiver queue links of all tasks, indexed by the task Id
+  #if ISOS_PROFILING
+  IsosProfile ProfileCounters;
+  #endif // ISOS_PROFILING
+  #if ISOS_TASK_STATS
+  IsosTaskStats* TaskStats; //the statistics of every task, indexed by the task Id
+  #endif // ISOS_TASK_STATS
+  #if ISOS_TRACE
+  IsosTrace* Trace; //where the scheduling decisions are recorded (or compared with), null if none
+  #endif // ISOS_TRACE
+  #if ISOS_TRACE_RING
+  IsosTraceRing* TraceRing; //where the events of the enabled categories are put, null if none
+  #endif // ISOS_TRACE_RING
+} IsosKernel;
+
+//Kernel functions, identical to the Isos_ functions below but working on the given kernel
+//While IsosKernel_Run runs, the kernel is the current kernel of the thread, so the task actions can keep using the Isos_ functions
+char IsosKernel_InitWithArena(IsosKernel* kernel, void* arena, long arenaSize, short resourceCapacity, short eventGroupCapacity, short mailboxCapacity); //returns 0 if the arena cannot hold MIN_TASK_SIZE tasks
+IsosKernel* IsosKernel_GetDefault(); //the kernel initialized by Isos_Init
+IsosKernel* IsosKernel_GetCurrent(); //the kernel the Isos_ functions work on, in the calling thread
+void IsosKernel_SetCurrent(IsosKernel* kernel); //for the calling thread only, i.e. to be called when a thread starts running its own kernel
+IsosClock IsosKernel_GetClock(IsosKernel* kernel);
+unsigned char IsosKernel_GetTaskFlags(IsosKernel* kernel, short taskId, unsigned char flagNo);
+IsosTask* IsosKernel_GetTask(IsosKernel* kernel, short taskId);
+short IsosKernel_GetTaskSize(IsosKernel* kernel);
+short IsosKernel_GetTaskCapacity(IsosKernel* kernel);
+void IsosKernel_SetTaskTimeout(IsosKernel* kernel, short taskId, short timeoutDay, long timeoutMs);
+void IsosKernel_SetTaskEnabled(IsosKernel* kernel, short taskId, char enabled);
+char IsosKernel_SetTaskParallelSafe(IsosKernel* kernel, short taskId, char parallelSafe);
+#if ISOS_PARALLEL_EXECUTOR
+void IsosKernel_SetExecutor(IsosKernel* kernel, struct IsosExecutorStruct* executor); //normally done by IsosExecutor_Start and IsosExecutor_Stop
+void IsosKernel_SetCurrentWorker(IsosKernel* kernel); //for an executor worker thread: the kernel becomes current, but refuses the calls changing it from this thread
+#endif // ISOS_PARALLEL_EXECUTOR
+char IsosKernel_RegisterNonCyclicalTask(IsosKernel* kernel, char enabled, short executionDueDay, long executionDueMs, short timeoutDay, long timeoutMs,
+                                        unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+IsosResourceTaskType IsosKernel_NextResourceTaskType(IsosKernel* kernel);
+char IsosKernel_RegisterResourceTaskWithBuffers(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                                unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
+                                                unsigned char* txBuffer, short txBufferSize, unsigned char* rxBuffer, short rxBufferSize);
+char IsosKernel_RegisterResourceTaskWithBuffer(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
+                                               char isTxBuffer, unsigned char* buffer, short bufferSize);
+char IsosKernel_RegisterResourceTask(IsosKernel* kernel, IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
+                                     unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+char IsosKernel_RegisterLooselyRepeatedTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                                            unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+char IsosKernel_RegisterRepeatedTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                                     unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+char IsosKernel_RegisterPeriodicTask(IsosKernel* kernel, char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
+                                     unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+void IsosKernel_ScheduleNonCyclicalTask(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset, short executionDueDay, long executionDueMs);
+void IsosKernel_DueNonCyclicalOrResourceTaskNow(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset);
+void IsosKernel_DueTaskNow(IsosKernel* kernel, IsosTaskInfo* taskInfo, unsigned char priority, char withReset);
+void IsosKernel_Run(IsosKernel* kernel);
+void IsosKernel_Wait(IsosKernel* kernel, short taskId, short waitingDay, long waitingMs);
+void IsosKernel_WaitFromSuspensionTime(IsosKernel* kernel, short taskId);
+void IsosKernel_Tick(IsosKernel* kernel);
+void IsosKernel_AdvanceClock(IsosKernel* kernel, short elapsedDay, long elapsedMs);
+char IsosKernel_GetNextDeadline(IsosKernel* kernel, IsosClock* deadline);
+char IsosKernel_GetNextTickDeadline(IsosKernel* kernel, IsosClock* deadline);
+#if ISOS_PROFILING
+void IsosKernel_GetProfile(IsosKernel* kernel, IsosProfile* profile);
+void IsosKernel_ResetProfile(IsosKernel* kernel);
+#endif // ISOS_PROFILING
+#if ISOS_TASK_STATS
+char IsosKernel_GetTaskStats(IsosKernel* kernel, short taskId, IsosTaskStats* stats);
+void IsosKernel_ResetTaskStats(IsosKernel* kernel, short taskId);
+#endif // ISOS_TASK_STATS
+#if ISOS_TRACE
+void IsosKernel_SetTrace(IsosKernel* kernel, IsosTrace* trace);
+void IsosKernel_TraceStimulus(IsosKernel* kernel, unsigned char kind, int value);
+char IsosKernel_Replay(IsosKernel* kernel, IsosTrace* trace, void (*stimulusAction)(unsigned char, int));
+#endif // ISOS_TRACE
+#if ISOS_TRACE_RING
+void IsosKernel_SetTraceRing(IsosKernel* kernel, IsosTraceRing* ring);
+#endif // ISOS_TRACE_RING
+char IsosKernel_ClaimResourceTask(IsosKernel* kernel, short claimerTaskId, IsosResourceTaskType type);
+char IsosKernel_WaitResourceTask(IsosKernel* kernel, short claimerTaskId, IsosResourceTaskType type);
+IsosResourceTaskType IsosKernel_GetFirstClaimedResource(IsosKernel* kernel, short taskId);
+IsosResourceTaskType IsosKernel_GetNextClaimedResource(IsosKernel* kernel, IsosResourceTaskType type);
+char IsosKernel_PrepareResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize);
+char IsosKernel_PrepareResourceTaskTxWithSizeReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize, short expectedRxDataSize);
+char IsosKernel_PrepareResourceTaskTxWithMessageReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize);
+char IsosKernel_PrepareResourceTaskTxWithTimeReturn(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* txData, short txDataSize, short waitRxDay, long waitRxMs);
+short IsosKernel_ReserveResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, IsosBufferSpan* span, short txDataSize);
+char IsosKernel_CommitResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize);
+char IsosKernel_CommitResourceTaskTxWithSizeReturn(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize, short expectedRxDataSize);
+char IsosKernel_CommitResourceTaskTxWithTimeReturn(IsosKernel* kernel, IsosResourceTaskType type, short txDataSize, short waitRxDay, long waitRxMs);
+IsosTaskState IsosKernel_GetResourceTaskState(IsosKernel* kernel, IsosResourceTaskType type);
+char IsosKernel_PeekResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize);
+char IsosKernel_GetResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize);
+short IsosKernel_PeekResourceTaskRxSpan(IsosKernel* kernel, IsosResourceTaskType type, IsosBufferSpan* span, short rxDataSize);
+char IsosKernel_ConsumeResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type, short rxDataSize);
+short IsosKernel_GetResourceTaskRxMessage(IsosKernel* kernel, IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize);
+void IsosKernel_ReleaseResourceTask(IsosKernel* kernel, IsosResourceTaskType type);
+void IsosKernel_FlushResourceTaskTx(IsosKernel* kernel, IsosResourceTaskType type);
+void IsosKernel_FlushResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type);
+short IsosKernel_GetResourceTaskTxDataSize(IsosKernel* kernel, IsosResourceTaskType type);
+short IsosKernel_GetResourceTaskRxDataSize(IsosKernel* kernel, IsosResourceTaskType type);
+char IsosKernel_ResourceTaskHasExpectedDataSize(IsosKernel* kernel, IsosResourceTaskType type, char isTx);
+IsosBuffer* IsosKernel_GetResourceTaskBuffer(IsosKernel* kernel, char* result, IsosResourceTaskType type, char isTx);
+char IsosKernel_GetResourceTaskBufferFlags(IsosKernel* kernel, IsosResourceTaskType type);
+void IsosKernel_NotifyResourceTaskRx(IsosKernel* kernel, IsosResourceTaskType type);
+short IsosKernel_RegisterEventGroup(IsosKernel* kernel);
+void IsosKernel_SetEvents(IsosKernel* kernel, short group, IsosEventBits bits);
+void IsosKernel_SetEventsFromIsr(IsosKernel* kernel, short group, IsosEventBits bits);
+void IsosKernel_SetWakeUpAction(IsosKernel* kernel, void (*wakeUpAction)(void*), void* argument); //normally done by the host runner, to stop its sleep on IsosKernel_SetEventsFromIsr
+void IsosKernel_ClearEvents(IsosKernel* kernel, short group, IsosEventBits bits);
+IsosEventBits IsosKernel_GetEvents(IsosKernel* kernel, short group);
+char IsosKernel_WaitEvents(IsosKernel* kernel, short taskId, short group, IsosEventBits bits, char waitAll);
+short IsosKernel_InitMessagePool(IsosKernel* kernel, void* memory, long memorySize, short blockSize);
+short IsosKernel_RegisterMailbox(IsosKernel* kernel, short messageSize, short capacity);
+char IsosKernel_PostMessage(IsosKernel* kernel, short mailbox, const void* message);
+char IsosKernel_ReceiveMessage(IsosKernel* kernel, short taskId, short mailbox, void* message);
+short IsosKernel_GetMailboxSize(IsosKernel* kernel, short mailbox);
+
+//The Isos_ functions below work on the current kernel of the calling thread (the default kernel, unless changed)
 
 //Initialization
-void Isos_Init();
+void Isos_Init(); //initializes the default kernel, using its own arena with MAX_TASK_SIZE, MAX_RESOURCE_SIZE, MAX_EVENT_GROUP_SIZE and MAX_MAILBOX_SIZE capacities
+//Initializes the current kernel, returns 0 if the arena cannot hold the resource, event group and mailbox tables and MIN_TASK_SIZE tasks
+char Isos_InitWithArena(void* arena, long arenaSize, short resourceCapacity, short eventGroupCapacity, short mailboxCapacity);
 
 //Utility functions
 IsosClock Isos_GetClock();
-unsigned char Isos_GetTaskFlags(unsigned char taskId, unsigned char flagNo);
-IsosTask* Isos_GetTask(unsigned char taskId); //intended to be called by "super user" outside
+unsigned char Isos_GetTaskFlags(short taskId, unsigned char flagNo);
+IsosTask* Isos_GetTask(short taskId); //intended to be called by "super user" outside
 short Isos_GetTaskSize();
-void Isos_SetTaskTimeout(unsigned char taskId, short timeoutDay, long timeoutMs);
+short Isos_GetTaskCapacity();
+void Isos_SetTaskTimeout(short taskId, short timeoutDay, long timeoutMs);
+void Isos_SetTaskEnabled(short taskId, char enabled); //to enable or disable a task from outside, so that the OS knows about it
+//A parallel-safe task action only uses its own action info and the read-only Isos_ functions (Isos_GetClock, Isos_GetTaskFlags, etc)
+//It must not claim resource tasks, wait, or due the other tasks, resource tasks themselves cannot be parallel-safe (returns 0)
+//Called from a parallel-safe task action, the functions changing the kernel do nothing (or return 0 or -1), only Isos_SetEvents is deferred to the next run
+char Isos_SetTaskParallelSafe(short taskId, char parallelSafe);
 
-//Task registration
+//Task registration, returns 0 if there is no more room for the task, or if a resource task buffer size is not valid (see IsosBuffer_IsValidSize)
 char Isos_RegisterNonCyclicalTask(char enabled, short executionDueDay, long executionDueMs, short timeoutDay, long timeoutMs,
-                              unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*));
+                              unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
+IsosResourceTaskType Isos_NextResourceTaskType(); //the first resource type which is not registered yet, to register the next resource task with
 char Isos_RegisterResourceTaskWithBuffers(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                                          unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*),
+                                          unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
                                           unsigned char* txBuffer, short txBufferSize, unsigned char* rxBuffer, short rxBufferSize);
 char Isos_RegisterResourceTaskWithBuffer(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                                         unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*),
+                                         unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*),
                                          char isTxBuffer, unsigned char* buffer, short bufferSize);
 char Isos_RegisterResourceTask(IsosResourceTaskType resourceType, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*));
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
 char Isos_RegisterLooselyRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                                      unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*));
+                                      unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
 char Isos_RegisterRepeatedTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*));
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
 char Isos_RegisterPeriodicTask(char enabled, short periodDay, long periodMs, short timeoutDay, long timeoutMs,
-                               unsigned char priority, void (*taskAction)(unsigned char, IsosTaskActionInfo*));
+                               unsigned char priority, void (*taskAction)(short, IsosTaskActionInfo*));
 
 //Tasks scheduling and execution functions
 void Isos_ScheduleNonCyclicalTask(IsosTaskInfo* taskInfo, unsigned char priority, char withReset, short executionDueDay, long executionDueMs);
 void Isos_DueNonCyclicalOrResourceTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset);
 void Isos_DueTaskNow(IsosTaskInfo* taskInfo, unsigned char priority, char withReset);
 void Isos_Run();
-void Isos_Wait(unsigned char taskId, short waitingDay, long waitingMs);
-void Isos_WaitFromSuspensionTime(unsigned char taskId);
+void Isos_Wait(short taskId, short waitingDay, long waitingMs);
+void Isos_WaitFromSuspensionTime(short taskId);
 void Isos_Tick();
+void Isos_AdvanceClock(short elapsedDay, long elapsedMs);
+char Isos_GetNextDeadline(IsosClock* deadline);
+char Isos_GetNextTickDeadline(IsosClock* deadline); //the next deadline on the scheduler period grid, see IsosSimulation
+
+#if ISOS_PROFILING
+//Profiling functions
+void Isos_GetProfile(IsosProfile* profile); //to get the accumulated profiling counters since Isos_Init or the last Isos_ResetProfile
+void Isos_ResetProfile();
+#endif // ISOS_PROFILING
+
+#if ISOS_TASK_STATS
+//Task statistics functions
+char Isos_GetTaskStats(short taskId, IsosTaskStats* stats); //to get a copy of the statistics of the task, returns 0 if there is no such task
+void Isos_ResetTaskStats(short taskId); //-1 to reset the statistics of all tasks
+#endif // ISOS_TASK_STATS
+
+#if ISOS_TRACE
+//Record and replay functions
+void Isos_SetTrace(IsosTrace* trace); //to record the scheduling decisions into the trace from now on, null to stop recording
+//To record an external stimulus (i.e. an ISR putting Rx data, or setting events) right before it is applied, so that it can be replayed
+//The kind and the value must be enough for the stimulus action given to Isos_Replay to apply the same stimulus again
+void Isos_TraceStimulus(unsigned char kind, int value);
+//Replays the recorded trace on the current kernel, which must be initialized and registered just like when the trace was recorded
+//The clock is moved to every recorded stimulus (fed back through the stimulus action) and scheduler run (the OS is run),
+//every other event must then happen again as recorded. Returns 0 on the first difference, see IsosTrace.MismatchIndex
+char Isos_Replay(IsosTrace* trace, void (*stimulusAction)(unsigned char, int));
+#endif // ISOS_TRACE
+
+#if ISOS_TRACE_RING
+//Trace ring functions
+//To put the events of the current kernel into the ring from now on, null to stop. The ring is drained by one thread only,
+//preferably out of the scheduling path (i.e. in the idle hook of the host runner, see IsosHostLinux_SetIdleAction)
+void Isos_SetTraceRing(IsosTraceRing* ring);
+#endif // ISOS_TRACE_RING
 
 //Resource tasks related functions
-char Isos_ClaimResourceTask(unsigned char claimerTaskId, IsosResourceTaskType type);
+char Isos_ClaimResourceTask(short claimerTaskId, IsosResourceTaskType type);
+char Isos_WaitResourceTask(short claimerTaskId, IsosResourceTaskType type); //suspends the claimer until the claimed resource task completes, 0 if it is not running
+IsosResourceTaskType Isos_GetFirstClaimedResource(short taskId); //the resource tasks claimed by the task, IsosResourceTaskType_Unspecified if none
+IsosResourceTaskType Isos_GetNextClaimedResource(IsosResourceTaskType type); //the next resource task claimed by the same task
 char Isos_PrepareResourceTaskTx(IsosResourceTaskType type, unsigned char* txData, short txDataSize);
 char Isos_PrepareResourceTaskTxWithSizeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short expectedRxDataSize);
+char Isos_PrepareResourceTaskTxWithMessageReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize); //Isos_ResourceTaskHasExpectedDataSize once per Rx message
 char Isos_PrepareResourceTaskTxWithTimeReturn(IsosResourceTaskType type, unsigned char* txData, short txDataSize, short waitRxDay, long waitRxMs);
+//Zero-copy alternatives of the prepare functions: the Tx data is written directly into the reserved span, then committed
+short Isos_ReserveResourceTaskTx(IsosResourceTaskType type, IsosBufferSpan* span, short txDataSize); //non-positive txDataSize to reserve all free space
+char Isos_CommitResourceTaskTx(IsosResourceTaskType type, short txDataSize);
+char Isos_CommitResourceTaskTxWithSizeReturn(IsosResourceTaskType type, short txDataSize, short expectedRxDataSize);
+char Isos_CommitResourceTaskTxWithTimeReturn(IsosResourceTaskType type, short txDataSize, short waitRxDay, long waitRxMs);
 IsosTaskState Isos_GetResourceTaskState(IsosResourceTaskType type);
 char Isos_PeekResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize);
 char Isos_GetResourceTaskRx(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize);
+//Zero-copy alternatives of the peek/get functions: the Rx data is read directly from the span, then consumed
+short Isos_PeekResourceTaskRxSpan(IsosResourceTaskType type, IsosBufferSpan* span, short rxDataSize);
+char Isos_ConsumeResourceTaskRx(IsosResourceTaskType type, short rxDataSize);
+short Isos_GetResourceTaskRxMessage(IsosResourceTaskType type, unsigned char* rxDataBuffer, short rxDataSize); //pops the first complete Rx message, returns its length
 void Isos_ReleaseResourceTask(IsosResourceTaskType type);
 void Isos_FlushResourceTaskTx(IsosResourceTaskType type);
 void Isos_FlushResourceTaskRx(IsosResourceTaskType type);
@@ -116,5 +427,26 @@ short Isos_GetResourceTaskRxDataSize(IsosResourceTaskType type);
 char Isos_ResourceTaskHasExpectedDataSize(IsosResourceTaskType type, char isTx);
 IsosBuffer* Isos_GetResourceTaskBuffer(char* result, IsosResourceTaskType type, char isTx); //To be used by ISR to get the needed buffer
 char Isos_GetResourceTaskBufferFlags(IsosResourceTaskType type); //0: no buffer, 1:Tx, 2:Rx, 3:TxRx
+void Isos_NotifyResourceTaskRx(IsosResourceTaskType type); //To be called by ISR (or I/O backend) after putting the Rx data, makes the claimed resource task due now
+
+//Event group functions, the waiting tasks are out of the due list until a matching bit is set (or until they time out)
+short Isos_RegisterEventGroup(); //returns the event group handle, -1 if there is no more room for the group
+void Isos_SetEvents(short group, IsosEventBits bits); //wakes up the tasks whose waited bits are now set
+void Isos_SetEventsFromIsr(short group, IsosEventBits bits); //To be called by ISR (or another thread), the bits are set on the next Isos_Run
+void Isos_ClearEvents(short group, IsosEventBits bits);
+IsosEventBits Isos_GetEvents(short group);
+//Suspends the task until any (or all, if waitAll) of the bits are set, 0 if they are already set (the task is not suspended)
+//Like Isos_WaitResourceTask, the task action should return right after it is suspended, the bits are not cleared by the waking up
+char Isos_WaitEvents(short taskId, short group, IsosEventBits bits, char waitAll);
+
+//Mailbox functions, the messages are copied in and out of the blocks of the message pool, there is no malloc
+//The message pool memory must be aligned for long long (i.e. declared as long long[]), see ISOS_BLOCK_POOL_SIZE
+short Isos_InitMessagePool(void* memory, long memorySize, short blockSize); //before registering any mailbox, returns the number of blocks
+short Isos_RegisterMailbox(short messageSize, short capacity); //returns the mailbox handle, -1 if there is no more room or the message is too large
+char Isos_PostMessage(short mailbox, const void* message); //wakes up the first receiver, 0 if the mailbox is full or the pool is exhausted
+//Takes the oldest message, or suspends the task until a message is posted if the mailbox is empty (returns 0), a taskId of -1 only takes
+//Like Isos_WaitResourceTask, the task action should return right after it is suspended, then receive again once it is woken up
+char Isos_ReceiveMessage(short taskId, short mailbox, void* message);
+short Isos_GetMailboxSize(short mailbox); //the number of messages queued
 
 #endif
@@ -0,0 +1,174 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_benchmark.c, isos_benchmark.h
+  - Headless benchmark of the OS overhead, to be built with the Benchmark build target (ISOS_PROFILING = 1, BASIC_DEBUG = 0)
+  - Register synthetic mixes of NonCyclical, LooselyRepeated, Repeated, Periodic and Resource tasks, from 10 up to MAX_TASK_SIZE tasks
+  - Drive Isos_Run and Isos_Tick for a given number of ticks per mix and print the results as CSV for trend tracking
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "isos_benchmark.h"
+
+#if !ISOS_PROFILING
+#error "isos_benchmark needs ISOS_PROFILING=1"
+#endif // ISOS_PROFILING
+
+static const char* BenchmarkMixNames[IsosBenchmarkMix_Size] = { "cyclical", "noncyclical", "mixed" };
+static unsigned char BenchmarkEndSubtasks[MAX_TASK_SIZE]; //on which subtask each task completes
+static IsosResourceTaskType BenchmarkClaimedResources[MAX_TASK_SIZE]; //which resource task each claimer task claims
+static short BenchmarkNonCyclicalTaskIds[MAX_TASK_SIZE]; //to re-schedule the completed NonCyclical tasks
+static short BenchmarkNonCyclicalTaskSize = 0;
+
+int main(int argc, char* argv[]) {
+  long ticks = argc > 1 ? atol(argv[1]) : BENCHMARK_DEFAULT_TICKS;
+  short taskSize;
+  int mix;
+  if (ticks <= 0){
+    fprintf(stderr, "Usage: %s [ticks per run, default %ld]\n", argv[0], BENCHMARK_DEFAULT_TICKS);
+    return 1;
+  }
+  printf("mix,tasks,ticks,scheduler_runs,dispatches,ns_per_tick,ns_per_dispatch,scheduler_ns,ready_queue_ns,execute_ns\n");
+  for (mix = 0; mix < IsosBenchmarkMix_Size; ++mix)
+    for (taskSize = BENCHMARK_MIN_TASK_SIZE; ; taskSize += BENCHMARK_TASK_SIZE_STEP){
+      if (taskSize > MAX_TASK_SIZE) //always ends with the full task list
+        taskSize = MAX_TASK_SIZE;
+      runBenchmark((IsosBenchmarkMix)mix, taskSize, ticks);
+      if (taskSize == MAX_TASK_SIZE)
+        break;
+    }
+  return 0;
+}
+
+void registerBenchmarkTasks(IsosBenchmarkMix mix, short taskSize){
+  short i, resourceSize = 0, cyclicalSize;
+  long periodMs;
+  unsigned char priority;
+  if (mix == IsosBenchmarkMix_Mixed){ //one resource task for every eight tasks, the resource tasks are registered first
+    resourceSize = taskSize / 8 < 1 ? 1 : taskSize / 8 > BENCHMARK_MAX_RESOURCE_SIZE ? BENCHMARK_MAX_RESOURCE_SIZE : taskSize / 8;
+    for (i = 0; i < resourceSize; ++i){
+      BenchmarkEndSubtasks[Isos_GetTaskSize()] = i % (BENCHMARK_MAX_SUBTASK + 1);
+      Isos_RegisterResourceTask((IsosResourceTaskType)i, 0, 0, MAX_PRIORITY - i, BenchmarkResourceTask);
+    }
+  }
+  BenchmarkNonCyclicalTaskSize = 0;
+  for (i = resourceSize; i < taskSize; ++i){
+    periodMs = 10 + (i * 37) % 190; //spread the periods between 10 and 199 ms so that the dues do not all come together
+    priority = (i * 7) % (MAX_PRIORITY - BENCHMARK_MAX_RESOURCE_SIZE); //all below the resource tasks
+    BenchmarkEndSubtasks[i] = i % (BENCHMARK_MAX_SUBTASK + 1);
+    cyclicalSize = mix == IsosBenchmarkMix_Mixed ? 5 : 3; //the mixed one also has the NonCyclical and the claimer tasks
+    if (mix == IsosBenchmarkMix_NonCyclical || (mix == IsosBenchmarkMix_Mixed && i % cyclicalSize == 3)){
+      BenchmarkNonCyclicalTaskIds[BenchmarkNonCyclicalTaskSize] = i;
+      BenchmarkNonCyclicalTaskSize++;
+      Isos_RegisterNonCyclicalTask(1, 0, periodMs, 0, 0, priority, BenchmarkTask);
+    } else if (mix == IsosBenchmarkMix_Mixed && i % cyclicalSize == 4){
+      BenchmarkClaimedResources[i] = (IsosResourceTaskType)(i % resourceSize);
+      Isos_RegisterRepeatedTask(1, 0, periodMs, 0, 0, priority, BenchmarkClaimerTask);
+    } else if (i % cyclicalSize == 0)
+      Isos_RegisterLooselyRepeatedTask(1, 0, periodMs, 0, 0, priority, BenchmarkTask);
+    else if (i % cyclicalSize == 1)
+      Isos_RegisterRepeatedTask(1, 0, periodMs, 0, 0, priority, BenchmarkTask);
+    else
+      Isos_RegisterPeriodicTask(1, 0, periodMs, 0, 0, priority, BenchmarkTask);
+  }
+}
+
+//The NonCyclical tasks are disabled by the OS once completed, schedule them again so that the mix keeps on running
+void rescheduleNonCyclicalTasks(){
+  IsosClock clock;
+  IsosTask* task;
+  short i;
+  for (i = 0; i < BenchmarkNonCyclicalTaskSize; ++i){
+    task = Isos_GetTask(BenchmarkNonCyclicalTaskIds[i]);
+    if (task->Info.ActionInfo.Enabled)
+      continue;
+    clock = Isos_GetClock();
+    IsosClock_AddMs(&clock, BENCHMARK_RESCHEDULE_MS);
+    Isos_ScheduleNonCyclicalTask(&task->Info, task->Info.Priority, 1, IsosClock_GetDay(&clock), IsosClock_GetMs(&clock));
+  }
+}
+
+void runBenchmark(IsosBenchmarkMix mix, short taskSize, long ticks){
+  IsosProfile profile;
+  long long startNs, elapsedNs;
+  long tick;
+  Isos_Init();
+  registerBenchmarkTasks(mix, taskSize);
+  Isos_ResetProfile();
+  startNs = IsosProfile_GetNs();
+  for (tick = 0; tick < ticks; ++tick){
+    Isos_Run();
+    Isos_Tick();
+    if (tick % BENCHMARK_RESCHEDULE_MS == 0)
+      rescheduleNonCyclicalTasks();
+  }
+  elapsedNs = IsosProfile_GetNs() - startNs;
+  Isos_GetProfile(&profile);
+  printf("%s,%d,%ld,%lld,%lld,%.2f,%.2f,%lld,%lld,%lld\n", BenchmarkMixNames[mix], taskSize, ticks,
+         profile.SchedulerRuns, profile.Dispatches, (double)elapsedNs / ticks,
+         profile.Dispatches > 0 ? (double)elapsedNs / profile.Dispatches : 0.0,
+         profile.SchedulerNs, profile.ReadyQueueNs, profile.ExecuteNs);
+}
+
+void simulateBenchmarkSubtasks(short taskId, IsosTaskActionInfo* taskActionInfo){
+  if (taskActionInfo->Subtask >= BenchmarkEndSubtasks[taskId])
+    taskActionInfo->State = IsosTaskState_Success;
+  else
+    taskActionInfo->Subtask++;
+}
+
+void BenchmarkTask(short taskId, IsosTaskActionInfo* taskActionInfo){
+  simulateBenchmarkSubtasks(taskId, taskActionInfo);
+}
+
+void BenchmarkResourceTask(short taskId, IsosTaskActionInfo* taskActionInfo){
+  simulateBenchmarkSubtasks(taskId, taskActionInfo);
+}
+
+void BenchmarkClaimerTask(short taskId, IsosTaskActionInfo* taskActionInfo){
+  IsosTaskState taskState;
+  IsosResourceTaskType type = BenchmarkClaimedResources[taskId];
+  switch(taskActionInfo->Subtask){
+  case 0:
+    if (Isos_ClaimResourceTask(taskId, type))
+      taskActionInfo->Subtask++;
+    break;
+  case 1:
+    taskState = Isos_GetResourceTaskState(type);
+    if (taskState == IsosTaskState_Success || taskState == IsosTaskState_Failed || taskState == IsosTaskState_Timeout){
+      Isos_ReleaseResourceTask(type);
+      taskActionInfo->Subtask++;
+    }
+    break;
+  default:
+    taskActionInfo->State = IsosTaskState_Success;
+    break;
+  }
+}
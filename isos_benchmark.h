@@ -0,0 +1,64 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_benchmark.c, isos_benchmark.h
+  - Headless benchmark of the OS overhead, to be built with the Benchmark build target (ISOS_PROFILING = 1, BASIC_DEBUG = 0)
+  - Register synthetic mixes of NonCyclical, LooselyRepeated, Repeated, Periodic and Resource tasks, from 10 up to MAX_TASK_SIZE tasks
+  - Drive Isos_Run and Isos_Tick for a given number of ticks per mix and print the results as CSV for trend tracking
+*/
+
+#ifndef ISOS_BENCHMARK_H
+#define ISOS_BENCHMARK_H
+
+#include "isos.h"
+
+#define BENCHMARK_DEFAULT_TICKS 1000000L //can be changed by the first argument of the program
+#define BENCHMARK_MIN_TASK_SIZE 10
+#define BENCHMARK_TASK_SIZE_STEP 10
+#define BENCHMARK_RESCHEDULE_MS 50 //how often the completed NonCyclical tasks are scheduled again
+#define BENCHMARK_MAX_SUBTASK 3 //the synthetic tasks take 1 to (BENCHMARK_MAX_SUBTASK + 1) executions to complete
+#define BENCHMARK_MAX_RESOURCE_SIZE 8 //one resource task for every eight tasks, up to this many
+
+typedef enum IsosBenchmarkMixEnum {
+  IsosBenchmarkMix_Cyclical, //LooselyRepeated, Repeated and Periodic tasks only
+  IsosBenchmarkMix_NonCyclical, //NonCyclical tasks only, scheduled again every BENCHMARK_RESCHEDULE_MS after they are completed
+  IsosBenchmarkMix_Mixed, //all task types, including resource tasks and the tasks claiming them
+  IsosBenchmarkMix_Size //to know how many mixes there are
+} IsosBenchmarkMix;
+
+void registerBenchmarkTasks(IsosBenchmarkMix mix, short taskSize);
+void rescheduleNonCyclicalTasks();
+void runBenchmark(IsosBenchmarkMix mix, short taskSize, long ticks);
+void simulateBenchmarkSubtasks(short taskId, IsosTaskActionInfo* taskActionInfo);
+
+void BenchmarkTask(short taskId, IsosTaskActionInfo* taskActionInfo); //completes after a few executions
+void BenchmarkResourceTask(short taskId, IsosTaskActionInfo* taskActionInfo); //completes after a few executions, when claimed
+void BenchmarkClaimerTask(short taskId, IsosTaskActionInfo* taskActionInfo); //claims a resource task, waits for it and releases it
+
+#endif // ISOS_BENCHMARK_H
@@ -0,0 +1,87 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_block_pool.c, isos_block_pool.h
+  - Describe the fixed-block pool used in ISOS to store the messages of the mailboxes, so that no malloc is needed at run time
+  - The pool does not own its memory, the blocks are carved out of the memory given on initialization
+  - Every block starts with a link, used to chain the free blocks (and the taken blocks, i.e. the messages queued in a mailbox)
+*/
+
+#include "isos_block_pool.h"
+
+short* IsosBlockPool_getLink(IsosBlockPool* pool, short index){
+  return (short*)(pool->Memory + pool->BlockStride * index);
+}
+
+short IsosBlockPool_Init(IsosBlockPool* pool, void* memory, long memorySize, short blockSize){
+  long blockCount;
+  short i;
+  pool->Memory = memory;
+  pool->BlockStride = blockSize > 0 ? (long)ISOS_BLOCK_POOL_STRIDE(blockSize) : 0;
+  pool->BlockSize = blockSize;
+  blockCount = blockSize > 0 && memorySize > 0 ? memorySize / pool->BlockStride : 0;
+  pool->BlockCount = blockCount > ISOS_BLOCK_POOL_MAX_BLOCK_COUNT ? ISOS_BLOCK_POOL_MAX_BLOCK_COUNT : (short)blockCount;
+  for (i = 0; i < pool->BlockCount; ++i) //all the blocks are free, in order
+    *IsosBlockPool_getLink(pool, i) = i + 1 < pool->BlockCount ? i + 1 : -1;
+  pool->FreeSize = pool->BlockCount;
+  pool->FirstFree = pool->BlockCount > 0 ? 0 : -1;
+  return pool->BlockCount;
+}
+
+short IsosBlockPool_Take(IsosBlockPool* pool){
+  short index = pool->FirstFree;
+  if (index < 0)
+    return -1;
+  pool->FirstFree = *IsosBlockPool_getLink(pool, index);
+  *IsosBlockPool_getLink(pool, index) = -1; //not chained to anything yet
+  pool->FreeSize--;
+  return index;
+}
+
+void IsosBlockPool_Give(IsosBlockPool* pool, short index){
+  *IsosBlockPool_getLink(pool, index) = pool->FirstFree; //the last given is the first taken, it is likely still in the cache
+  pool->FirstFree = index;
+  pool->FreeSize++;
+}
+
+void* IsosBlockPool_GetBlock(IsosBlockPool* pool, short index){
+  return pool->Memory + pool->BlockStride * index + ISOS_BLOCK_POOL_ALIGNMENT;
+}
+
+short IsosBlockPool_GetNext(IsosBlockPool* pool, short index){
+  return *IsosBlockPool_getLink(pool, index);
+}
+
+void IsosBlockPool_SetNext(IsosBlockPool* pool, short index, short nextIndex){
+  *IsosBlockPool_getLink(pool, index) = nextIndex;
+}
+
+short IsosBlockPool_GetFreeSize(IsosBlockPool* pool){
+  return pool->FreeSize;
+}
@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -30,74 +30,144 @@
   isos_buffer.c, isos_buffer.h
   - Describe the buffer structures and functions used in ISOS
   - Buffers in ISOS are circular
+  - Optionally, the buffer sizes are powers of two, so that the indices are wrapped with a mask instead of a division
+  - Provide span functions to write and read the data in place, without copying it from/to another array
+  - Provide message functions to use the buffer as a queue of variable-length messages, each behind a 1 or 2-byte length header
 */
 
 #include "isos_buffer.h"
 #include <string.h>
 
+#if BUFFER_POWER_OF_TWO
+#define BUFFER_MAX_POWER_OF_TWO_SIZE 16384 //the largest power of two which fits in a short
+#endif // BUFFER_POWER_OF_TWO
+
+char IsosBuffer_IsValidSize(short bufferSize){
+  #if BUFFER_POWER_OF_TWO
+  return bufferSize >= 0 && bufferSize <= BUFFER_MAX_POWER_OF_TWO_SIZE && (bufferSize & (bufferSize - 1)) == 0;
+  #else
+  return bufferSize >= 0;
+  #endif // BUFFER_POWER_OF_TWO
+}
+
 void IsosBuffer_Init(IsosBuffer* isosBuffer, unsigned char* buffer, short bufferSize){
   isosBuffer->Buffer = buffer;
   isosBuffer->BufferSize = bufferSize; //buffer size info should be provided
+  #if BUFFER_POWER_OF_TWO
+  isosBuffer->Mask = bufferSize > 0 ? (unsigned short)(bufferSize - 1) : 0;
+  #endif // BUFFER_POWER_OF_TWO
   IsosBuffer_ResetState(isosBuffer);
 }
 
+short IsosBuffer_GetDataSize(const IsosBuffer* isosBuffer){
+  #if BUFFER_POWER_OF_TWO
+  return (short)(unsigned short)(isosBuffer->PutIndex - isosBuffer->GetIndex); //still right when the put index has wrapped around
+  #else
+  return isosBuffer->DataSize;
+  #endif // BUFFER_POWER_OF_TWO
+}
+
+//The positions in the buffer memory of the get and put indices
+short IsosBuffer_getPosition(const IsosBuffer* isosBuffer){
+  #if BUFFER_POWER_OF_TWO
+  return isosBuffer->GetIndex & isosBuffer->Mask;
+  #else
+  return isosBuffer->GetIndex;
+  #endif // BUFFER_POWER_OF_TWO
+}
+
+short IsosBuffer_putPosition(const IsosBuffer* isosBuffer){
+  #if BUFFER_POWER_OF_TWO
+  return isosBuffer->PutIndex & isosBuffer->Mask;
+  #else
+  return isosBuffer->PutIndex;
+  #endif // BUFFER_POWER_OF_TWO
+}
+
+//The position of the byte at the offset from the get index
+short IsosBuffer_offsetPosition(const IsosBuffer* isosBuffer, short offset){
+  #if BUFFER_POWER_OF_TWO
+  return (isosBuffer->GetIndex + offset) & isosBuffer->Mask;
+  #else
+  return (isosBuffer->GetIndex + offset) % isosBuffer->BufferSize;
+  #endif // BUFFER_POWER_OF_TWO
+}
+
+void IsosBuffer_advancePut(IsosBuffer* isosBuffer, short itemSize){
+  #if BUFFER_POWER_OF_TWO
+  isosBuffer->PutIndex += itemSize; //free-running, never needs to be wrapped
+  #else
+  isosBuffer->DataSize += itemSize; //increase both the DataSize and PutIndex by itemSize
+  isosBuffer->PutIndex += itemSize;
+  isosBuffer->PutIndex = isosBuffer->PutIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  #endif // BUFFER_POWER_OF_TWO
+}
+
+void IsosBuffer_advanceGet(IsosBuffer* isosBuffer, short itemSize){
+  #if BUFFER_POWER_OF_TWO
+  isosBuffer->GetIndex += itemSize; //free-running, never needs to be wrapped
+  #else
+  isosBuffer->DataSize -= itemSize; //reduce the data size as many as the itemSize retrieved
+  isosBuffer->GetIndex += itemSize;
+  isosBuffer->GetIndex = isosBuffer->GetIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  #endif // BUFFER_POWER_OF_TWO
+}
+
 void IsosBuffer_ResetState(IsosBuffer* isosBuffer){
   memset(isosBuffer->Buffer, 0, isosBuffer->BufferSize); //set everything to zero
+  #if !BUFFER_POWER_OF_TWO
   isosBuffer->DataSize = 0;
+  #endif // BUFFER_POWER_OF_TWO
   isosBuffer->PutIndex = 0;
   isosBuffer->GetIndex = 0;
 }
 
 void IsosBuffer_Flush(IsosBuffer* isosBuffer){
+  #if !BUFFER_POWER_OF_TWO
   isosBuffer->DataSize = 0; //set the data size to zero
+  #endif // BUFFER_POWER_OF_TWO
   isosBuffer->GetIndex = isosBuffer->PutIndex; //get index equal to put index
 }
 
 //Expected to be used by ISR to put Rx data one-by-one in the buffer for later-retrieval
 char IsosBuffer_Put(IsosBuffer* isosBuffer, unsigned char item){
-  if (isosBuffer->DataSize >= isosBuffer->BufferSize) //buffer is full! nothing can be put anymore
+  if (IsosBuffer_GetDataSize(isosBuffer) >= isosBuffer->BufferSize) //buffer is full! nothing can be put anymore
     return 0;
-  isosBuffer->Buffer[isosBuffer->PutIndex] = item;
-  isosBuffer->DataSize++; //increases the data size of the buffer
-  isosBuffer->PutIndex++; //increases the put index, so that next time item will be placed in the next index
-  isosBuffer->PutIndex = isosBuffer->PutIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  isosBuffer->Buffer[IsosBuffer_putPosition(isosBuffer)] = item;
+  IsosBuffer_advancePut(isosBuffer, 1); //so that next time item will be placed in the next index
   return 1; //successful
 }
 
 //Expected to be used by ISR / task to peek data from the Rx buffer initiated by external party
 char IsosBuffer_Peek(IsosBuffer* isosBuffer, unsigned char* item){
-  if (!isosBuffer->DataSize) //nothing in the buffer
+  if (!IsosBuffer_GetDataSize(isosBuffer)) //nothing in the buffer
     return 0;
-  *item = isosBuffer->Buffer[isosBuffer->GetIndex];
+  *item = isosBuffer->Buffer[IsosBuffer_getPosition(isosBuffer)];
   return 1; //successful
 }
 
 //Expected to be used by ISR to put Tx data one-by-one from the buffer for transmission
 char IsosBuffer_Get(IsosBuffer* isosBuffer, unsigned char* item){
-  if (!isosBuffer->DataSize) //nothing in the buffer
+  if (!IsosBuffer_Peek(isosBuffer, item)) //nothing in the buffer
     return 0;
-  *item = isosBuffer->Buffer[isosBuffer->GetIndex];
-  isosBuffer->DataSize--; //reduces the data size of the buffer
-  isosBuffer->GetIndex++; //increases the get index, so that next time item will be obtained from the next index
-  isosBuffer->GetIndex = isosBuffer->GetIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  IsosBuffer_advanceGet(isosBuffer, 1); //so that next time item will be obtained from the next index
   return 1; //successful
 }
 
 //Expected to be used by resource task to put all Tx data in the buffer before starting the transmission
 char IsosBuffer_Puts(IsosBuffer* isosBuffer, unsigned char* items, short itemSize){
   char willOverflow;
-  short copySize, maxCopySize;
-  if (isosBuffer->DataSize + itemSize > isosBuffer->BufferSize) //will overflow if continued!
+  short copySize, maxCopySize, putPosition;
+  if (IsosBuffer_GetDataSize(isosBuffer) + itemSize > isosBuffer->BufferSize) //will overflow if continued!
     return 0; //unsuccessful
-  maxCopySize = isosBuffer->BufferSize - isosBuffer->PutIndex;
+  putPosition = IsosBuffer_putPosition(isosBuffer);
+  maxCopySize = isosBuffer->BufferSize - putPosition;
   willOverflow = itemSize > maxCopySize;
   copySize = willOverflow ? maxCopySize : itemSize;
-  memcpy(&isosBuffer->Buffer[isosBuffer->PutIndex], items, copySize); //copy to segment from this current index to the last index
+  memcpy(&isosBuffer->Buffer[putPosition], items, copySize); //copy to segment from this current index to the last index
   if (willOverflow) //if it will overflow, copy for the second time
     memcpy(isosBuffer->Buffer, &items[copySize], itemSize - copySize); //copy to segment from 0-index to the current index-1
-  isosBuffer->DataSize += itemSize; //increase both the DataSize and PutIndex by itemSize
-  isosBuffer->PutIndex += itemSize;
-  isosBuffer->PutIndex = isosBuffer->PutIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  IsosBuffer_advancePut(isosBuffer, itemSize);
   return 1;
 }
 
@@ -106,21 +176,22 @@ char IsosBuffer_Puts(IsosBuffer* isosBuffer, unsigned char* items, short itemSiz
 //If minItemSize is positive, then only get all data if the DataSize in the buffer >= minItemSize
 short IsosBuffer_Peeks(IsosBuffer* isosBuffer, unsigned char* items, short minItemSize){
   char willOverflow;
-  short itemSize, copySize, maxCopySize;
-  itemSize = isosBuffer->DataSize; //assume itemSize to be DataSize unless proven otherwise
+  short itemSize, copySize, maxCopySize, getPosition;
+  itemSize = IsosBuffer_GetDataSize(isosBuffer); //assume itemSize to be DataSize unless proven otherwise
   if (minItemSize > 0){ //positive expected minimum item size
-    if (isosBuffer->DataSize + minItemSize > isosBuffer->BufferSize) //will overflow if continued!
+    if (itemSize + minItemSize > isosBuffer->BufferSize) //will overflow if continued!
       return 0; //unsuccessful
-    if (isosBuffer->DataSize < minItemSize) //positive minItemSize but DataSize is smaller than that
+    if (itemSize < minItemSize) //positive minItemSize but DataSize is smaller than that
       return 0; //unsuccessful
     itemSize = minItemSize; //updates itemSize to be retrieved to minItemSize as specified only on successful case
   }
   if (itemSize <= 0) //nothing to return
     return 0;
-  maxCopySize = isosBuffer->BufferSize - isosBuffer->GetIndex;
+  getPosition = IsosBuffer_getPosition(isosBuffer);
+  maxCopySize = isosBuffer->BufferSize - getPosition;
   willOverflow = itemSize > maxCopySize;
   copySize = willOverflow ? maxCopySize : itemSize;
-  memcpy(items, &isosBuffer->Buffer[isosBuffer->GetIndex], copySize); //copy from segment from this current index to the last index
+  memcpy(items, &isosBuffer->Buffer[getPosition], copySize); //copy from segment from this current index to the last index
   if (willOverflow)
     memcpy(&items[copySize], isosBuffer->Buffer, itemSize - copySize); //copy from segment from 0-index to the current index-1
   return itemSize; //returns the itemSize
@@ -134,19 +205,159 @@ short IsosBuffer_Gets(IsosBuffer* isosBuffer, unsigned char* items, short minIte
   itemSize = IsosBuffer_Peeks(isosBuffer, items, minItemSize);
   if (!itemSize) //if no item size is detected, then immediately returns
     return 0;
-  isosBuffer->DataSize -= itemSize; //reduce the data size as many as the itemSize retrieved
-  isosBuffer->GetIndex += itemSize; //adds the get index pointer as many as the itemSize retrieved
-  isosBuffer->GetIndex = isosBuffer->GetIndex % isosBuffer->BufferSize; //so that the index will never be placed outside the buffer memory
+  IsosBuffer_advanceGet(isosBuffer, itemSize); //moves the get index as many as the itemSize retrieved
   return itemSize; //returns the itemSize
 }
 
 //Very special function to determine if a buffer contains expected data size
 //See IsosBuffer.ExpectedDataSize description in isos_buffer.h
 char IsosBuffer_HasExpectedDataSize(IsosBuffer* isosBuffer){
+  if (isosBuffer->ExpectedDataSize == BUFFER_EXPECTED_MESSAGE) //true once per message, as long as the task pops each message it gets
+    return IsosBuffer_PeekMessageLength(isosBuffer) > 0;
   if (isosBuffer->ExpectedDataSize < 0) //negative value means expecting any positive data size
-    return isosBuffer->DataSize > 0;
+    return IsosBuffer_GetDataSize(isosBuffer) > 0;
   if (isosBuffer->ExpectedDataSize == 0) //zero value means does not expect any data size from this buffer
     return 1; //always return true
   //positive value can only be true if the data size in this buffer is AT LEAST as many as expected
-  return isosBuffer->DataSize >= isosBuffer->ExpectedDataSize;
+  return IsosBuffer_GetDataSize(isosBuffer) >= isosBuffer->ExpectedDataSize;
+}
+
+//The span of itemSize starting from the position, split in two where the buffer memory ends
+void IsosBuffer_fillSpan(IsosBuffer* isosBuffer, IsosBufferSpan* span, short position, short itemSize){
+  short maxRegionSize = isosBuffer->BufferSize - position;
+  span->Regions[0] = &isosBuffer->Buffer[position];
+  span->RegionSizes[0] = itemSize > maxRegionSize ? maxRegionSize : itemSize;
+  span->RegionSizes[1] = itemSize - span->RegionSizes[0];
+  span->Regions[1] = span->RegionSizes[1] > 0 ? isosBuffer->Buffer : (void*)0;
+  span->Size = itemSize;
+}
+
+//Expected to be used by resource task to build the Tx data directly in the buffer
+//Nothing is changed in the buffer until IsosBuffer_CommitWrite, so the reservation can simply be dropped
+short IsosBuffer_ReserveWrite(IsosBuffer* isosBuffer, IsosBufferSpan* span, short itemSize){
+  short freeSize = isosBuffer->BufferSize - IsosBuffer_GetDataSize(isosBuffer);
+  if (itemSize <= 0) //non-positive means reserving all the free space
+    itemSize = freeSize;
+  if (itemSize <= 0 || itemSize > freeSize) //will overflow if continued!
+    return 0; //unsuccessful
+  IsosBuffer_fillSpan(isosBuffer, span, IsosBuffer_putPosition(isosBuffer), itemSize);
+  return itemSize;
+}
+
+char IsosBuffer_CommitWrite(IsosBuffer* isosBuffer, short itemSize){
+  if (itemSize < 0 || IsosBuffer_GetDataSize(isosBuffer) + itemSize > isosBuffer->BufferSize)
+    return 0; //unsuccessful
+  if (itemSize > 0)
+    IsosBuffer_advancePut(isosBuffer, itemSize);
+  return 1;
+}
+
+//Expected to be used by resource task to parse the Rx data directly in the buffer
+//If minItemSize is non-positive, then all data will be in the span
+//If minItemSize is positive, then only minItemSize data will be in the span, if the data size in the buffer >= minItemSize
+short IsosBuffer_PeekRead(IsosBuffer* isosBuffer, IsosBufferSpan* span, short minItemSize){
+  short itemSize;
+  itemSize = IsosBuffer_GetDataSize(isosBuffer);
+  if (minItemSize > 0){ //positive expected minimum item size
+    if (itemSize < minItemSize) //positive minItemSize but the data size is smaller than that
+      return 0; //unsuccessful
+    itemSize = minItemSize;
+  }
+  if (itemSize <= 0) //nothing to return
+    return 0;
+  IsosBuffer_fillSpan(isosBuffer, span, IsosBuffer_getPosition(isosBuffer), itemSize);
+  return itemSize;
+}
+
+char IsosBuffer_ConsumeRead(IsosBuffer* isosBuffer, short itemSize){
+  if (itemSize < 0 || itemSize > IsosBuffer_GetDataSize(isosBuffer))
+    return 0; //unsuccessful
+  if (itemSize > 0)
+    IsosBuffer_advanceGet(isosBuffer, itemSize);
+  return 1;
+}
+
+//Reads the length header of the first message, returns the header size (0 if the header is not complete yet)
+short IsosBuffer_peekMessageHeader(const IsosBuffer* isosBuffer, short* itemSize){
+  short dataSize;
+  unsigned char first;
+  dataSize = IsosBuffer_GetDataSize(isosBuffer);
+  if (dataSize <= 0)
+    return 0;
+  first = isosBuffer->Buffer[IsosBuffer_getPosition(isosBuffer)];
+  if (!(first & 0x80)){
+    *itemSize = first;
+    return 1;
+  }
+  if (dataSize < 2)
+    return 0;
+  *itemSize = (short)(((first & 0x7F) << 8) | isosBuffer->Buffer[IsosBuffer_offsetPosition(isosBuffer, 1)]);
+  return 2;
+}
+
+//Expected to be used by resource task to put a whole Tx message (or by a simulated device to put a whole Rx message)
+char IsosBuffer_PushMessage(IsosBuffer* isosBuffer, unsigned char* items, short itemSize){
+  unsigned char header[2];
+  short headerSize;
+  if (itemSize <= 0) //any positive (short) length fits the header, up to BUFFER_MAX_MESSAGE_SIZE
+    return 0; //empty message cannot be told apart from no message
+  headerSize = itemSize < 0x80 ? 1 : 2;
+  if (IsosBuffer_GetDataSize(isosBuffer) + headerSize + itemSize > isosBuffer->BufferSize) //will overflow if continued!
+    return 0; //unsuccessful, nothing is put
+  if (headerSize == 1)
+    header[0] = (unsigned char)itemSize;
+  else {
+    header[0] = (unsigned char)(0x80 | (itemSize >> 8));
+    header[1] = (unsigned char)(itemSize & 0xFF);
+  }
+  IsosBuffer_Puts(isosBuffer, header, headerSize);
+  IsosBuffer_Puts(isosBuffer, items, itemSize); //the message is only complete (seen by the reader) once this is put
+  return 1;
+}
+
+//Returns the header size of the first message if it is complete (0 if not yet)
+//Only the header is read, so it costs the same whatever the message length and however many messages are queued
+short IsosBuffer_peekCompleteMessage(const IsosBuffer* isosBuffer, short* itemSize){
+  short headerSize;
+  headerSize = IsosBuffer_peekMessageHeader(isosBuffer, itemSize);
+  if (!headerSize || IsosBuffer_GetDataSize(isosBuffer) < headerSize + *itemSize) //the rest of the message has not come yet
+    return 0;
+  return headerSize;
+}
+
+short IsosBuffer_PeekMessageLength(const IsosBuffer* isosBuffer){
+  short itemSize;
+  if (!IsosBuffer_peekCompleteMessage(isosBuffer, &itemSize))
+    return 0;
+  return itemSize;
+}
+
+short IsosBuffer_PeekMessage(IsosBuffer* isosBuffer, IsosBufferSpan* span){
+  short headerSize, itemSize;
+  headerSize = IsosBuffer_peekCompleteMessage(isosBuffer, &itemSize);
+  if (!headerSize || !itemSize)
+    return 0;
+  IsosBuffer_fillSpan(isosBuffer, span, IsosBuffer_offsetPosition(isosBuffer, headerSize), itemSize); //skips the header
+  return itemSize;
+}
+
+//An empty message (never pushed by IsosBuffer_PushMessage, but it may come from the other side) is simply dropped
+short IsosBuffer_PopMessage(IsosBuffer* isosBuffer, unsigned char* items, short maxItemSize){
+  IsosBufferSpan span;
+  short headerSize, itemSize;
+  headerSize = IsosBuffer_peekCompleteMessage(isosBuffer, &itemSize);
+  if (headerSize && !itemSize){
+    IsosBuffer_advanceGet(isosBuffer, headerSize);
+    headerSize = IsosBuffer_peekCompleteMessage(isosBuffer, &itemSize);
+  }
+  if (!headerSize || !itemSize || (items && itemSize > maxItemSize)) //the message which does not fit stays in the buffer
+    return 0;
+  if (items){
+    IsosBuffer_fillSpan(isosBuffer, &span, IsosBuffer_offsetPosition(isosBuffer, headerSize), itemSize);
+    memcpy(items, span.Regions[0], span.RegionSizes[0]);
+    if (span.RegionSizes[1] > 0)
+      memcpy(&items[span.RegionSizes[0]], span.Regions[1], span.RegionSizes[1]);
+  }
+  IsosBuffer_advanceGet(isosBuffer, headerSize + itemSize); //the header and the message at once
+  return itemSize;
 }
@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -30,25 +30,51 @@
   isos_buffer.c, isos_buffer.h
   - Describe the buffer structures and functions used in ISOS
   - Buffers in ISOS are circular
+  - Optionally, the buffer sizes are powers of two, so that the indices are wrapped with a mask instead of a division
+  - Provide span functions to write and read the data in place, without copying it from/to another array
+  - Provide message functions to use the buffer as a queue of variable-length messages, each behind a 1 or 2-byte length header
 */
 
 #ifndef ISOS_BUFFER_H
 #define ISOS_BUFFER_H
 
+#ifndef BUFFER_POWER_OF_TWO
+#define BUFFER_POWER_OF_TWO 0 //set to 1 to only accept buffer sizes of 0 or a power of two (up to 16,384), the index wrap then costs a mask only
+#endif // BUFFER_POWER_OF_TWO
+
+#define BUFFER_MAX_MESSAGE_SIZE 0x7FFF //the message length header is 1 byte for length < 0x80, otherwise 2 bytes (the first one with the top bit set)
+#define BUFFER_EXPECTED_MESSAGE (-0x7FFF - 1) //special IsosBuffer.ExpectedDataSize: expecting one complete message
+
 //The IsosBuffer is circular
 typedef struct IsosBufferStruct {
   unsigned char* Buffer; //pointer to buffer
   short BufferSize; //the size of the buffer
+  #if BUFFER_POWER_OF_TWO
+  unsigned short PutIndex; //free-running put index of the buffer, the position in the buffer is PutIndex & Mask
+  unsigned short GetIndex; //free-running get index of the buffer, the data size is PutIndex - GetIndex, so there is no DataSize
+  unsigned short Mask; //BufferSize - 1
+  #else
   short PutIndex; //current put index of the buffer
   short GetIndex; //current get index of the buffer
   short DataSize; //the current size of data buffered. As long as > 0, means there is (are) data
+  #endif // BUFFER_POWER_OF_TWO
   short ExpectedDataSize; //ExpectedDataSize: very special parameter
                           // negative value means expecting any data size on this buffer
                           // zero value means expecting no data size at all on this buffer
                           // positive value means expecting AT LEAST specified (expected) data size found in this buffer
+                          // BUFFER_EXPECTED_MESSAGE means expecting at least one complete message found in this buffer
 } IsosBuffer;
 
-void IsosBuffer_Init(IsosBuffer* isosBuffer, unsigned char* buffer, short bufferSize);
+//A part of the buffer memory given to be written or read in place, in up to two regions since the buffer is circular
+typedef struct IsosBufferSpanStruct {
+  unsigned char* Regions[2]; //the second region always starts from the 0-index of the buffer memory, null if not needed
+  short RegionSizes[2];
+  short Size; //the total size of both regions
+} IsosBufferSpan;
+
+char IsosBuffer_IsValidSize(short bufferSize); //any non-negative size, or only 0 and the powers of two when BUFFER_POWER_OF_TWO is set
+void IsosBuffer_Init(IsosBuffer* isosBuffer, unsigned char* buffer, short bufferSize); //the buffer size must be valid
+short IsosBuffer_GetDataSize(const IsosBuffer* isosBuffer); //the current size of data buffered
 void IsosBuffer_ResetState(IsosBuffer* isosBuffer); //if something goes wrong, use this to reset the buffer's state
 void IsosBuffer_Flush(IsosBuffer* isosBuffer); //to clear the buffer up to this state, clearing any remaining data, if there is any
 char IsosBuffer_Put(IsosBuffer* isosBuffer, unsigned char item); //to put data to the buffer, if unsuccessful, returns 0
@@ -60,5 +86,16 @@ short IsosBuffer_Peeks(IsosBuffer* isosBuffer, unsigned char* items, short minIt
 //to get data (plural) from the buffer, use non-positive minItemSize to indicate "retrieve all available data". If unsuccessful, returns 0. If successful, returns the itemSize retrieved.
 short IsosBuffer_Gets(IsosBuffer* isosBuffer, unsigned char* items, short minItemSize);
 char IsosBuffer_HasExpectedDataSize(IsosBuffer* isosBuffer); //very special function which makes use of IsosBuffer.ExpectedDataSize info
+//Zero-copy writing: reserve the free space (non-positive itemSize for all of it), write the data into the span, then commit what is written
+short IsosBuffer_ReserveWrite(IsosBuffer* isosBuffer, IsosBufferSpan* span, short itemSize); //all or nothing, if unsuccessful, returns 0
+char IsosBuffer_CommitWrite(IsosBuffer* isosBuffer, short itemSize); //the data becomes available to be read, if more than the free space, returns 0
+//Zero-copy reading: peek the data in the span (see IsosBuffer_Peeks for minItemSize), read it, then consume what is read
+short IsosBuffer_PeekRead(IsosBuffer* isosBuffer, IsosBufferSpan* span, short minItemSize);
+char IsosBuffer_ConsumeRead(IsosBuffer* isosBuffer, short itemSize); //the space becomes free to be written, if more than the data size, returns 0
+//Message queue: do not mix with the byte functions above on the same buffer, except the Rx data put by ISR (or I/O backend) in the same format
+char IsosBuffer_PushMessage(IsosBuffer* isosBuffer, unsigned char* items, short itemSize); //all or nothing (header included), if unsuccessful, returns 0
+short IsosBuffer_PeekMessageLength(const IsosBuffer* isosBuffer); //the length of the first message, 0 if there is no complete message (yet)
+short IsosBuffer_PeekMessage(IsosBuffer* isosBuffer, IsosBufferSpan* span); //the first message in the span to be read in place, returns its length (0 if none)
+short IsosBuffer_PopMessage(IsosBuffer* isosBuffer, unsigned char* items, short maxItemSize); //null items to drop it, if none or longer than maxItemSize, returns 0
 
 #endif // ISOS_BUFFER_H
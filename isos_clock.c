@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -36,6 +36,56 @@
 #include <string.h>
 #include "isos_clock.h"
 
+#if CLOCK_64BIT_TICKS
+
+//In the 64-bit ticks mode, the day and the ms are only used to create and to read the clock, everything else is done on the ticks
+
+IsosClock IsosClock_Create(short day, long ms){
+  IsosClock clock;
+  clock.Ticks = (long long)day * MS_PER_DAY + ms;
+  return clock;
+}
+
+void IsosClock_Adjust(IsosClock *clock){ } //ticks are always adjusted
+
+IsosClock IsosClock_Add(const IsosClock* clock, const IsosClock* addClock){
+  IsosClock resultClock;
+  resultClock.Ticks = clock->Ticks + addClock->Ticks;
+  return resultClock;
+}
+
+IsosClock IsosClock_Minus(const IsosClock *clock, const IsosClock *minusClock){
+  IsosClock resultClock;
+  resultClock.Ticks = clock->Ticks - minusClock->Ticks;
+  return resultClock;
+}
+
+int IsosClock_GetDirection(const IsosClock *adjustedClock){
+  return (adjustedClock->Ticks > 0) - (adjustedClock->Ticks < 0);
+}
+
+int IsosClock_Compare(const IsosClock *clock, const IsosClock *otherClock){
+  return (clock->Ticks > otherClock->Ticks) - (clock->Ticks < otherClock->Ticks);
+}
+
+char IsosClock_IsZero(const IsosClock *clock){ return clock->Ticks == 0; }
+
+void IsosClock_AddMs(IsosClock *clock, long ms){ clock->Ticks += ms; }
+
+short IsosClock_GetDay(const IsosClock *clock){ return (short)(clock->Ticks / MS_PER_DAY); }
+
+long IsosClock_GetMs(const IsosClock *clock){ return (long)(clock->Ticks % MS_PER_DAY); }
+
+long long IsosClock_ToMs(const IsosClock *clock){ return clock->Ticks; }
+
+IsosClock IsosClock_FromMs(long long ms){
+  IsosClock clock;
+  clock.Ticks = ms;
+  return clock;
+}
+
+#else
+
 IsosClock IsosClock_Create(short day, long ms){
   IsosClock clock;
   clock.Day = day;
@@ -88,3 +138,34 @@ int IsosClock_GetDirection(const IsosClock *adjustedClock){
     return adjustedClock->Ms > 0 ? 1 : -1; //the case for 0 would have been taken cared of
   return -1; //otherwise it is always negative result
 }
+
+//Both clocks are adjusted, so the day decides first, and the ms only when the days are the same
+int IsosClock_Compare(const IsosClock *clock, const IsosClock *otherClock){
+  if (clock->Day != otherClock->Day)
+    return clock->Day > otherClock->Day ? 1 : -1;
+  return (clock->Ms > otherClock->Ms) - (clock->Ms < otherClock->Ms);
+}
+
+char IsosClock_IsZero(const IsosClock *clock){ return clock->Day == 0 && clock->Ms == 0; }
+
+void IsosClock_AddMs(IsosClock *clock, long ms){
+  clock->Ms += ms;
+  while (clock->Ms >= MS_PER_DAY){ //only loops when ms is more than a day
+    clock->Ms -= MS_PER_DAY;
+    clock->Day++;
+  }
+}
+
+short IsosClock_GetDay(const IsosClock *clock){ return clock->Day; }
+
+long IsosClock_GetMs(const IsosClock *clock){ return clock->Ms; }
+
+long long IsosClock_ToMs(const IsosClock *clock){
+  return (long long)clock->Day * MS_PER_DAY + clock->Ms;
+}
+
+IsosClock IsosClock_FromMs(long long ms){
+  return IsosClock_Create((short)(ms / MS_PER_DAY), (long)(ms % MS_PER_DAY));
+}
+
+#endif // CLOCK_64BIT_TICKS
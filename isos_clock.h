@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -39,15 +39,35 @@
 #define S_PER_DAY 86400
 #define MS_PER_DAY (MS_PER_S * S_PER_DAY)
 
+//Set to 1 to keep the clock as a single 64-bit monotonic tick (ms) count: comparisons and additions become single integer operations
+//Set to 0 to keep the clock as a {Day, Ms} pair
+//Either way, use the functions below (not the fields) to create and to read the clock, so that the task code compiles in both modes
+#ifndef CLOCK_64BIT_TICKS
+#define CLOCK_64BIT_TICKS 0
+#endif // CLOCK_64BIT_TICKS
+
+#if CLOCK_64BIT_TICKS
+typedef struct IsosClock{
+  long long Ticks; //number of ms since the clock is started
+} IsosClock;
+#else
 typedef struct IsosClock{
   short Day;
   long Ms;
 } IsosClock;
+#endif // CLOCK_64BIT_TICKS
 
 IsosClock IsosClock_Create(short day, long ms);
 void IsosClock_Adjust(IsosClock *clock);
 IsosClock IsosClock_Add(const IsosClock *clock, const IsosClock *addClock);
 IsosClock IsosClock_Minus(const IsosClock *clock, const IsosClock *minusClock);
 int IsosClock_GetDirection(const IsosClock *adjustedClock);
+int IsosClock_Compare(const IsosClock *clock, const IsosClock *otherClock); //-1: earlier than, 0: same as, 1: later than the other clock, both must be adjusted
+char IsosClock_IsZero(const IsosClock *clock);
+void IsosClock_AddMs(IsosClock *clock, long ms); //to move the clock forward by (non-negative) ms, in place
+short IsosClock_GetDay(const IsosClock *clock);
+long IsosClock_GetMs(const IsosClock *clock); //the ms part of the day
+long long IsosClock_ToMs(const IsosClock *clock); //the clock as a single number of ms
+IsosClock IsosClock_FromMs(long long ms);
 
 #endif
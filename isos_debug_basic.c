@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -55,19 +55,12 @@ char* IsosDebugBasic_TaskTypeToString(IsosTaskType type){
   return "UNKNOWN";
 }
 
-char* IsosDebugBasic_ResourceTypeToString(IsosResourceTaskType type){
-  switch(type){
-    case IsosResourceTaskType_Type1: return "Type 1";
-    case IsosResourceTaskType_Type2: return "Type 2";
-    case IsosResourceTaskType_Type3: return "Type 3";
-    case IsosResourceTaskType_Type4: return "Type 4";
-    case IsosResourceTaskType_Type5: return "Type 5";
-    case IsosResourceTaskType_Type6: return "Type 6";
-    case IsosResourceTaskType_Type7: return "Type 7";
-    case IsosResourceTaskType_Type8: return "Type 8";
-    case IsosResourceTaskType_Unspecified:
-    default: return "Unspecified";
-  }
+//Any resource type can be registered, not only the named ones, so the text is made on the fly into the results (of 16 chars at least)
+char* IsosDebugBasic_ResourceTypeToString(IsosResourceTaskType type, char* results){
+  if (type < 0)
+    return "Unspecified";
+  sprintf(results, "Type %d", type + 1); //IsosResourceTaskType_Type1 is 0
+  return results;
 }
 
 char* IsosDebugBasic_TaskStateToString(IsosTaskState state){
@@ -100,13 +93,14 @@ void IsosDebugBasic_printBuffersAvailable(IsosResourceTaskType type){
   }
 }
 
-void IsosDebugBasic_PrintResourceClaiming(IsosResourceTaskType type, char result, unsigned char id){
+void IsosDebugBasic_PrintResourceClaiming(IsosResourceTaskType type, char result, short id){
+  char typeResults[16];
   if (PRINT_RESOURCE_EVENT){
     IsosDebugBasic_PrintFrontBlank();
-    printf("Claiming resource [%s] [Task Id: %02d]", IsosDebugBasic_ResourceTypeToString(type), id);
+    printf("Claiming resource [%s] [Task Id: %02d]", IsosDebugBasic_ResourceTypeToString(type, typeResults), id);
     IsosDebugBasic_printBuffersAvailable(type);
     switch(result){
-      case -1: printf(": Failed (has more important next claimer)\n"); break;
+      case -1: printf(": Failed (has more important waiter)\n"); break;
       case 0:  printf(": Failed (is still claimed or is running)\n"); break;
       case 1:  printf(": Successful\n"); break;
     }
@@ -125,8 +119,8 @@ char* IsosDebugBasic_bufferEventToString(char eventNo){
 }
 
 void IsosDebugBasic_PrintBufferData(IsosBuffer* buffer){
-  char isTooMany = buffer->DataSize > BUFFER_PRINTED_DATA_LIMIT;
-  int i, excessNo, printedDataNo = isTooMany ? BUFFER_PRINTED_DATA_LIMIT : buffer->DataSize;
+  char isTooMany = IsosBuffer_GetDataSize(buffer) > BUFFER_PRINTED_DATA_LIMIT;
+  int i, excessNo, printedDataNo = isTooMany ? BUFFER_PRINTED_DATA_LIMIT : IsosBuffer_GetDataSize(buffer);
   unsigned char data[BUFFER_PRINTED_DATA_LIMIT];
   IsosBuffer_Peeks(buffer, data, isTooMany ? BUFFER_PRINTED_DATA_LIMIT : -1); //just get data size not more than the data array can hold
   IsosDebugBasic_PrintFrontBlank();
@@ -140,7 +134,7 @@ void IsosDebugBasic_PrintBufferData(IsosBuffer* buffer){
       printf("%.2X", data[i]);
     }
   if (isTooMany){
-    excessNo = buffer->DataSize - printedDataNo;
+    excessNo = IsosBuffer_GetDataSize(buffer) - printedDataNo;
     printf(" ... +%d more data ", excessNo);
   }
   printf("]\n");
@@ -149,38 +143,40 @@ void IsosDebugBasic_PrintBufferData(IsosBuffer* buffer){
 //0 -> Get, 1 -> Peek, 2 -> Put
 void IsosDebugBasic_PrintResourceTaskBufferData(IsosResourceTaskType type, IsosBuffer* buffer, char eventNo){
   IsosBuffer* testBuffer;
-  char isTx, dummyResult;
+  char isTx, dummyResult, typeResults[16];
   if (PRINT_BUFFER_EVENT){
     testBuffer = Isos_GetResourceTaskBuffer(&dummyResult, type, 1); //try to get Tx buffer
     isTx = buffer == testBuffer;
     IsosDebugBasic_PrintFrontBlank();
     printf("%s resource [%s] buffer [%cx], size: [available: %d, directed: %d]\n",
-           IsosDebugBasic_bufferEventToString(eventNo), IsosDebugBasic_ResourceTypeToString(type),
-           isTx ? 'T' : 'R', buffer->DataSize, buffer->ExpectedDataSize);
+           IsosDebugBasic_bufferEventToString(eventNo), IsosDebugBasic_ResourceTypeToString(type, typeResults),
+           isTx ? 'T' : 'R', IsosBuffer_GetDataSize(buffer), buffer->ExpectedDataSize);
     IsosDebugBasic_PrintBufferData(buffer);
   }
 }
 
-void IsosDebugBasic_PrintResourceChecking(IsosResourceTaskType type, IsosTaskState state, unsigned char id){
+void IsosDebugBasic_PrintResourceChecking(IsosResourceTaskType type, IsosTaskState state, short id){
+  char typeResults[16];
   if (PRINT_RESOURCE_EVENT){
     IsosDebugBasic_PrintFrontBlank();
-    printf("Checking resource [%s] [Task Id: %02d]: %s\n", IsosDebugBasic_ResourceTypeToString(type), id, IsosDebugBasic_TaskStateToString(state));
+    printf("Checking resource [%s] [Task Id: %02d]: %s\n", IsosDebugBasic_ResourceTypeToString(type, typeResults), id, IsosDebugBasic_TaskStateToString(state));
   }
 }
 
-void IsosDebugBasic_PrintResourceReleasing(IsosResourceTaskType type, unsigned char id){
+void IsosDebugBasic_PrintResourceReleasing(IsosResourceTaskType type, short id){
+  char typeResults[16];
   if (PRINT_RESOURCE_EVENT){
     IsosDebugBasic_PrintFrontBlank();
-    printf("Releasing resource [%s] [Task Id: %02d]...\n", IsosDebugBasic_ResourceTypeToString(type), id);
+    printf("Releasing resource [%s] [Task Id: %02d]...\n", IsosDebugBasic_ResourceTypeToString(type, typeResults), id);
   }
 }
 
 //Ensuring the value of clock to be unchanged inside the function
 void IsosDebugBasic_GetPrintClock(const IsosClock* clock, char* results){
-  short dayPart = clock->Day;
-  long mMsPart = clock->Ms / 1000000;
-  long kMsPart = (clock->Ms / 1000) % 1000;
-  long msPart = clock->Ms % 1000;
+  short dayPart = IsosClock_GetDay(clock);
+  long mMsPart = IsosClock_GetMs(clock) / 1000000;
+  long kMsPart = (IsosClock_GetMs(clock) / 1000) % 1000;
+  long msPart = IsosClock_GetMs(clock) % 1000;
   results[0] = 0x30 + dayPart / 100;
   results[1] = 0x30 + ((dayPart / 10) % 10);
   results[2] = 0x30 + dayPart % 10;
@@ -204,7 +200,7 @@ void IsosDebugBasic_PrintClock(const IsosClock* clock){
 
 void IsosDebugBasic_PrintTaskInfo(const IsosTaskInfo* taskInfo){
   char mainClockResults[13], clockResults[13], timeoutClockResults[13];
-  char hasTimeout = !(taskInfo->Timeout.Day == 0 && taskInfo->Timeout.Ms == 0);
+  char hasTimeout = !IsosClock_IsZero(&taskInfo->Timeout);
   IsosClock mainClock = Isos_GetClock();
   IsosDebugBasic_GetPrintClock(&mainClock, mainClockResults);
   IsosDebugBasic_GetPrintClock(&taskInfo->TimeInfo.Any, clockResults);
@@ -291,6 +287,44 @@ void IsosDebugBasic_PrintEndWaitingNote(const IsosTaskInfo* taskInfo){
     printf("[Note]      : Task [%d] suspension time is over\n", taskInfo->Id);
 }
 
+void IsosDebugBasic_PrintResourceWaitingNote(const IsosTaskInfo* taskInfo, IsosResourceTaskType type, short id){
+  char typeResults[16];
+  if (PRINT_SUBTASK_EVENT){
+    IsosDebugBasic_PrintFrontBlank();
+    printf("Task [%d] is [Suspended] until resource [%s] [Task Id: %02d] completes\n", taskInfo->Id, IsosDebugBasic_ResourceTypeToString(type, typeResults), id);
+  }
+}
+
+void IsosDebugBasic_PrintResourceWakingNote(short claimerId, IsosResourceTaskType type){
+  char typeResults[16];
+  if (PRINT_SUBTASK_EVENT)
+    printf("[Note]      : Task [%d] is woken up, resource [%s] has completed\n", claimerId, IsosDebugBasic_ResourceTypeToString(type, typeResults));
+}
+
+void IsosDebugBasic_PrintEventWaitingNote(const IsosTaskInfo* taskInfo, short group, IsosEventBits bits, char waitAll){
+  if (PRINT_SUBTASK_EVENT){
+    IsosDebugBasic_PrintFrontBlank();
+    printf("Task [%d] is [Suspended] until %s of the events [0x%lX] of group [%d] are set\n", taskInfo->Id, waitAll ? "all" : "any", bits, group);
+  }
+}
+
+void IsosDebugBasic_PrintEventWakingNote(short waiterId, short group, IsosEventBits setBits){
+  if (PRINT_SUBTASK_EVENT)
+    printf("[Note]      : Task [%d] is woken up, the events of group [%d] are now [0x%lX]\n", waiterId, group, setBits);
+}
+
+void IsosDebugBasic_PrintMailboxWaitingNote(const IsosTaskInfo* taskInfo, short mailbox){
+  if (PRINT_SUBTASK_EVENT){
+    IsosDebugBasic_PrintFrontBlank();
+    printf("Task [%d] is [Suspended] until a message is posted to mailbox [%d]\n", taskInfo->Id, mailbox);
+  }
+}
+
+void IsosDebugBasic_PrintMailboxWakingNote(short waiterId, short mailbox){
+  if (PRINT_SUBTASK_EVENT)
+    printf("[Note]      : Task [%d] is woken up, a message has been posted to mailbox [%d]\n", waiterId, mailbox);
+}
+
 void IsosDebugBasic_PrintForcedTimeoutDetected(const IsosTaskInfo* taskInfo){
   char clockResults[13];
   if(PRINT_OS_TIMEOUT_EVENT){
@@ -305,7 +339,7 @@ void IsosDebugBasic_PrintForcedTimeoutDetected(const IsosTaskInfo* taskInfo){
   }
 }
 
-void IsosDebugBasic_PrintStuckTask(unsigned char taskId){
+void IsosDebugBasic_PrintStuckTask(short taskId){
   if (PRINT_OS_TIMEOUT_EVENT)
     printf("[Note]      : Task [%d] is STUCK!\n", taskId);
 }
@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -58,15 +58,15 @@ typedef struct IsosFlagsExampleStruct {
 } IsosFlagsExample;
 
 char* IsosDebugBasic_TaskTypeToString(IsosTaskType type);
-char* IsosDebugBasic_ResourceTypeToString(IsosResourceTaskType type);
+char* IsosDebugBasic_ResourceTypeToString(IsosResourceTaskType type, char* results);
 char* IsosDebugBasic_TaskStateToString(IsosTaskState state);
 void IsosDebugBasic_PrintFrontBlank();
 void IsosDebugBasic_PrintResourceTaskInvalid(IsosResourceTaskType type);
-void IsosDebugBasic_PrintResourceClaiming(IsosResourceTaskType type, char result, unsigned char id);
+void IsosDebugBasic_PrintResourceClaiming(IsosResourceTaskType type, char result, short id);
 void IsosDebugBasic_PrintBufferData(IsosBuffer* buffer);
 void IsosDebugBasic_PrintResourceTaskBufferData(IsosResourceTaskType type, IsosBuffer* buffer, char eventNo);
-void IsosDebugBasic_PrintResourceChecking(IsosResourceTaskType type, IsosTaskState state, unsigned char id);
-void IsosDebugBasic_PrintResourceReleasing(IsosResourceTaskType type, unsigned char id);
+void IsosDebugBasic_PrintResourceChecking(IsosResourceTaskType type, IsosTaskState state, short id);
+void IsosDebugBasic_PrintResourceReleasing(IsosResourceTaskType type, short id);
 void IsosDebugBasic_GetPrintClock(const IsosClock* clock, char* results);
 void IsosDebugBasic_PrintClock(const IsosClock* clock);
 void IsosDebugBasic_PrintTaskInfo(const IsosTaskInfo* taskInfo);
@@ -75,7 +75,13 @@ void IsosDebugBasic_PrintDueTasksEnding(short dueSize);
 void IsosDebugBasic_PrintSubtaskNote(char subtaskCase, short subtaskDirectionNo, char isResource);
 void IsosDebugBasic_PrintWaitingNote(const IsosTaskInfo* taskInfo);
 void IsosDebugBasic_PrintEndWaitingNote(const IsosTaskInfo* taskInfo);
+void IsosDebugBasic_PrintResourceWaitingNote(const IsosTaskInfo* taskInfo, IsosResourceTaskType type, short id);
+void IsosDebugBasic_PrintResourceWakingNote(short claimerId, IsosResourceTaskType type);
+void IsosDebugBasic_PrintEventWaitingNote(const IsosTaskInfo* taskInfo, short group, IsosEventBits bits, char waitAll);
+void IsosDebugBasic_PrintEventWakingNote(short waiterId, short group, IsosEventBits setBits);
+void IsosDebugBasic_PrintMailboxWaitingNote(const IsosTaskInfo* taskInfo, short mailbox);
+void IsosDebugBasic_PrintMailboxWakingNote(short waiterId, short mailbox);
 void IsosDebugBasic_PrintForcedTimeoutDetected(const IsosTaskInfo* taskInfo);
-void IsosDebugBasic_PrintStuckTask(unsigned char taskId);
+void IsosDebugBasic_PrintStuckTask(short taskId);
 
 #endif
@@ -0,0 +1,75 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_event_group.c, isos_event_group.h
+  - Describe the event group used in ISOS for inter-task signalling: a set of event bits which tasks set, clear and wait on
+  - The bits set by an ISR (or another thread) are only posted as pending bits with an atomic OR, the kernel takes
+    them in on its next run, so the ISR never touches the waiter lists
+*/
+
+#ifndef ISOS_EVENT_GROUP_H
+#define ISOS_EVENT_GROUP_H
+
+typedef unsigned long IsosEventBits; //at least 32 event bits per group
+
+//The pending bits are posted with an atomic OR and taken with an atomic exchange, so that no bit posted in between is lost
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+typedef atomic_ulong IsosPendingEventBits;
+#define ISOS_EVENT_INIT(pending) atomic_init(&(pending), 0)
+#define ISOS_EVENT_POST(pending, bits) atomic_fetch_or_explicit(&(pending), (bits), memory_order_release)
+#define ISOS_EVENT_TAKE(pending) atomic_exchange_explicit(&(pending), 0, memory_order_acquire)
+#define ISOS_EVENT_PEEK(pending) atomic_load_explicit(&(pending), memory_order_relaxed)
+#elif defined(__GNUC__)
+typedef unsigned long IsosPendingEventBits;
+#define ISOS_EVENT_INIT(pending) ((pending) = 0)
+#define ISOS_EVENT_POST(pending, bits) __atomic_fetch_or(&(pending), (bits), __ATOMIC_RELEASE)
+#define ISOS_EVENT_TAKE(pending) __atomic_exchange_n(&(pending), 0, __ATOMIC_ACQUIRE)
+#define ISOS_EVENT_PEEK(pending) __atomic_load_n(&(pending), __ATOMIC_RELAXED)
+#else
+typedef volatile unsigned long IsosPendingEventBits; //no atomics, only for single-core targets where the kernel takes the bits with the interrupts disabled
+#define ISOS_EVENT_INIT(pending) ((pending) = 0)
+#define ISOS_EVENT_POST(pending, bits) ((pending) |= (bits))
+#define ISOS_EVENT_TAKE(pending) IsosEventGroup_takeUnguarded(&(pending))
+#define ISOS_EVENT_PEEK(pending) (pending)
+IsosEventBits IsosEventGroup_takeUnguarded(IsosPendingEventBits* pending);
+#endif
+
+typedef struct IsosEventGroupStruct {
+  IsosEventBits Bits; //the bits set so far, only changed by the kernel (and the tasks)
+  IsosPendingEventBits PendingBits; //the bits posted by an ISR, not yet taken in by the kernel
+  short FirstWaiterId; //the first task waiting on the group, -1 if there is none
+} IsosEventGroup;
+
+void IsosEventGroup_Init(IsosEventGroup* group);
+void IsosEventGroup_Post(IsosEventGroup* group, IsosEventBits bits); //to be called by ISR, wait-free
+IsosEventBits IsosEventGroup_TakePending(IsosEventGroup* group); //the bits posted since the last take, to be called by the kernel only
+char IsosEventGroup_Matches(IsosEventBits setBits, IsosEventBits waitedBits, char waitAll); //any (or all) of the waited bits are set
+
+#endif // ISOS_EVENT_GROUP_H
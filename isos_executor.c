@@ -0,0 +1,177 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_executor.c, isos_executor.h
+  - Provide the parallel executor of ISOS for Linux (multi-core hosts), opt-in per kernel and per task
+  - On every scheduler run, the actions of the due parallel-safe tasks are run together on a pool of threads,
+    the scheduler thread runs them too, then waits for all of them before running the rest of the due tasks
+  - Each thread takes the tasks from its own slice of the run (the youngest first), and steals from the slices
+    of the other threads (the oldest first) when its own slice is empty, so that a long task does not hold up the others
+  - Resource task claims and releases, due and timeout checks are never done on the executor threads
+*/
+
+#include "isos.h"
+#include "isos_executor.h"
+
+#if ISOS_PARALLEL_EXECUTOR
+
+short IsosExecutor_takeOwnTask(IsosExecutorWorker* worker){
+  short taskId = -1;
+  pthread_mutex_lock(&worker->Lock);
+  if (worker->Top < worker->Bottom){
+    worker->Bottom--;
+    taskId = worker->Executor->TaskIds[worker->Bottom];
+  }
+  pthread_mutex_unlock(&worker->Lock);
+  return taskId;
+}
+
+short IsosExecutor_stealTask(IsosExecutor* executor, IsosExecutorWorker* thief){
+  IsosExecutorWorker* worker;
+  short i, taskId = -1;
+  for (i = 0; i <= executor->WorkerSize && taskId < 0; ++i){
+    worker = &executor->Workers[i];
+    if (worker == thief)
+      continue;
+    pthread_mutex_lock(&worker->Lock);
+    if (worker->Top < worker->Bottom){
+      taskId = executor->TaskIds[worker->Top];
+      worker->Top++;
+    }
+    pthread_mutex_unlock(&worker->Lock);
+  }
+  return taskId;
+}
+
+//Runs the task actions until there is nothing left to take or to steal
+void IsosExecutor_runUntilEmpty(IsosExecutor* executor, IsosExecutorWorker* worker){
+  IsosTask* task;
+  short taskId;
+  while ((taskId = IsosExecutor_takeOwnTask(worker)) >= 0 || (taskId = IsosExecutor_stealTask(executor, worker)) >= 0){
+    task = IsosKernel_GetTask(executor->Kernel, taskId);
+    task->Action(taskId, &task->Info.ActionInfo);
+    pthread_mutex_lock(&executor->Lock);
+    executor->PendingTaskSize--;
+    if (executor->PendingTaskSize == 0)
+      pthread_cond_signal(&executor->RunFinished);
+    pthread_mutex_unlock(&executor->Lock);
+  }
+}
+
+void* IsosExecutor_runThread(void* argument){
+  IsosExecutorWorker* worker = argument;
+  IsosExecutor* executor = worker->Executor;
+  unsigned long runNo = 0;
+  IsosKernel_SetCurrentWorker(executor->Kernel); //so that the Isos_ functions called by the task actions work on the kernel, without changing it
+  pthread_mutex_lock(&executor->Lock);
+  while (1){
+    while (!executor->Stopping && executor->RunNo == runNo)
+      pthread_cond_wait(&executor->RunStarted, &executor->Lock);
+    if (executor->Stopping)
+      break;
+    runNo = executor->RunNo;
+    pthread_mutex_unlock(&executor->Lock);
+    IsosExecutor_runUntilEmpty(executor, worker);
+    pthread_mutex_lock(&executor->Lock);
+  }
+  pthread_mutex_unlock(&executor->Lock);
+  return (void*)0;
+}
+
+char IsosExecutor_Start(IsosExecutor* executor, IsosKernel* kernel, short workerSize){
+  short i;
+  if (workerSize < 0 || workerSize > EXECUTOR_MAX_WORKER_SIZE)
+    return 0;
+  executor->Kernel = kernel;
+  executor->WorkerSize = 0;
+  executor->TaskIds = (void*)0;
+  executor->PendingTaskSize = 0;
+  executor->RunNo = 0;
+  executor->Stopping = 0;
+  pthread_mutex_init(&executor->Lock, (void*)0);
+  pthread_cond_init(&executor->RunStarted, (void*)0);
+  pthread_cond_init(&executor->RunFinished, (void*)0);
+  for (i = 0; i <= EXECUTOR_MAX_WORKER_SIZE; ++i){
+    executor->Workers[i].Executor = executor;
+    executor->Workers[i].Top = 0;
+    executor->Workers[i].Bottom = 0;
+    pthread_mutex_init(&executor->Workers[i].Lock, (void*)0);
+  }
+  for (i = 0; i < workerSize; ++i){
+    if (pthread_create(&executor->Workers[i].Thread, (void*)0, IsosExecutor_runThread, &executor->Workers[i]) != 0){
+      IsosExecutor_Stop(executor); //stops the threads already started
+      return 0;
+    }
+    executor->WorkerSize++;
+  }
+  IsosKernel_SetExecutor(kernel, executor);
+  return 1;
+}
+
+//To be called by the scheduler thread only, which runs the task actions too instead of just waiting
+void IsosExecutor_RunTasks(IsosExecutor* executor, short* taskIds, short taskSize){
+  IsosExecutorWorker* worker;
+  short i, sliceSize;
+  if (taskSize <= 0)
+    return;
+  sliceSize = (short)(taskSize / (executor->WorkerSize + 1));
+  pthread_mutex_lock(&executor->Lock);
+  executor->TaskIds = taskIds;
+  executor->PendingTaskSize = taskSize;
+  for (i = 0; i <= executor->WorkerSize; ++i){ //even slices, the last one (the scheduler thread) takes the remainder
+    worker = &executor->Workers[i];
+    pthread_mutex_lock(&worker->Lock);
+    worker->Top = (short)(i * sliceSize);
+    worker->Bottom = i == executor->WorkerSize ? taskSize : (short)((i + 1) * sliceSize);
+    pthread_mutex_unlock(&worker->Lock);
+  }
+  executor->RunNo++;
+  pthread_cond_broadcast(&executor->RunStarted);
+  pthread_mutex_unlock(&executor->Lock);
+  IsosExecutor_runUntilEmpty(executor, &executor->Workers[executor->WorkerSize]);
+  pthread_mutex_lock(&executor->Lock);
+  while (executor->PendingTaskSize > 0) //the tasks stolen by the pool threads may still be running
+    pthread_cond_wait(&executor->RunFinished, &executor->Lock);
+  pthread_mutex_unlock(&executor->Lock);
+}
+
+void IsosExecutor_Stop(IsosExecutor* executor){
+  short i;
+  if (executor->Kernel->Executor == executor)
+    IsosKernel_SetExecutor(executor->Kernel, (void*)0);
+  pthread_mutex_lock(&executor->Lock);
+  executor->Stopping = 1;
+  pthread_cond_broadcast(&executor->RunStarted);
+  pthread_mutex_unlock(&executor->Lock);
+  for (i = 0; i < executor->WorkerSize; ++i)
+    pthread_join(executor->Workers[i].Thread, (void**)0);
+  executor->WorkerSize = 0;
+}
+
+#endif // ISOS_PARALLEL_EXECUTOR
@@ -0,0 +1,76 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_executor.c, isos_executor.h
+  - Provide the parallel executor of ISOS for Linux (multi-core hosts), opt-in per kernel and per task
+  - On every scheduler run, the actions of the due parallel-safe tasks are run together on a pool of threads,
+    the scheduler thread runs them too, then waits for all of them before running the rest of the due tasks
+  - Each thread takes the tasks from its own slice of the run (the youngest first), and steals from the slices
+    of the other threads (the oldest first) when its own slice is empty, so that a long task does not hold up the others
+  - Resource task claims and releases, due and timeout checks are never done on the executor threads
+*/
+
+#ifndef ISOS_EXECUTOR_H
+#define ISOS_EXECUTOR_H
+
+#include "isos.h"
+
+#define EXECUTOR_MAX_WORKER_SIZE 16 //the threads of the pool, not counting the scheduler thread
+
+#if ISOS_PARALLEL_EXECUTOR
+#include <pthread.h>
+
+//One slice of the run per thread, taken by its owner from the bottom and stolen by the other threads from the top
+typedef struct IsosExecutorWorkerStruct {
+  struct IsosExecutorStruct* Executor;
+  pthread_t Thread; //not used by the slice of the scheduler thread
+  short Top; //the next task Id index to be stolen
+  short Bottom; //one past the next task Id index to be taken by the owner
+  pthread_mutex_t Lock; //guards Top and Bottom
+} IsosExecutorWorker;
+
+typedef struct IsosExecutorStruct {
+  IsosKernel* Kernel; //the kernel whose tasks are run, it is also the current kernel of the pool threads
+  IsosExecutorWorker Workers[EXECUTOR_MAX_WORKER_SIZE + 1]; //the slices of the pool threads, the slice at index WorkerSize is the one of the scheduler thread
+  short WorkerSize; //the threads of the pool
+  short* TaskIds; //the task Ids of the current run, shared by all slices
+  short PendingTaskSize; //the tasks of the current run which are not finished yet
+  unsigned long RunNo; //raised on every run, to wake the pool threads up
+  char Stopping;
+  pthread_mutex_t Lock; //guards everything above but the slices
+  pthread_cond_t RunStarted;
+  pthread_cond_t RunFinished;
+} IsosExecutor;
+
+char IsosExecutor_Start(IsosExecutor* executor, IsosKernel* kernel, short workerSize); //starts the pool and sets it to the kernel, returns 0 if failed
+void IsosExecutor_RunTasks(IsosExecutor* executor, short* taskIds, short taskSize); //runs the task actions, returns when all of them are finished
+void IsosExecutor_Stop(IsosExecutor* executor); //takes the pool out of the kernel, then stops its threads and waits for them
+#endif // ISOS_PARALLEL_EXECUTOR
+
+#endif // ISOS_EXECUTOR_H
@@ -0,0 +1,140 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_heap.c, isos_heap.h
+  - Describe the clock-keyed binary min-heap used in ISOS to index tasks by their (absolute) due time
+  - The earliest due is always on top, so the OS only needs to look at the top to know whether anything is due
+*/
+
+#include <string.h>
+#include "isos_heap.h"
+
+void IsosHeap_Init(IsosHeap* heap, IsosHeapItem* items, short* positions, short capacity){
+  heap->Items = items;
+  heap->Positions = positions;
+  heap->Capacity = capacity;
+  heap->Size = 0;
+  memset(positions, -1, sizeof(short) * capacity); //no task is in the heap yet
+}
+
+char IsosHeap_isEarlier(const IsosHeapItem* item, const IsosHeapItem* otherItem){
+  return IsosClock_Compare(&item->Due, &otherItem->Due) < 0;
+}
+
+void IsosHeap_setItem(IsosHeap* heap, short index, const IsosHeapItem* item){
+  heap->Items[index] = *item;
+  heap->Positions[item->TaskId] = index; //always keep the position of the task in line with the items array
+}
+
+//Moves the item up until its parent is not later than it
+void IsosHeap_siftUp(IsosHeap* heap, short index){
+  IsosHeapItem item;
+  short parentIndex;
+  item = heap->Items[index];
+  while (index > 0){
+    parentIndex = (index - 1) / 2;
+    if (!IsosHeap_isEarlier(&item, &heap->Items[parentIndex]))
+      break;
+    IsosHeap_setItem(heap, index, &heap->Items[parentIndex]); //moves the parent down
+    index = parentIndex;
+  }
+  IsosHeap_setItem(heap, index, &item);
+}
+
+//Moves the item down until none of its children is earlier than it
+void IsosHeap_siftDown(IsosHeap* heap, short index){
+  IsosHeapItem item;
+  int childIndex; //not a short: the child of an index above 16383 is beyond the range of a short
+  item = heap->Items[index];
+  while (1){
+    childIndex = 2 * index + 1;
+    if (childIndex >= heap->Size)
+      break;
+    if (childIndex + 1 < heap->Size && IsosHeap_isEarlier(&heap->Items[childIndex + 1], &heap->Items[childIndex]))
+      childIndex++; //takes the earlier child of the two
+    if (!IsosHeap_isEarlier(&heap->Items[childIndex], &item))
+      break;
+    IsosHeap_setItem(heap, index, &heap->Items[childIndex]); //moves the child up
+    index = (short)childIndex; //a child before the heap size, so it fits in a short
+  }
+  IsosHeap_setItem(heap, index, &item);
+}
+
+char IsosHeap_Contains(const IsosHeap* heap, short taskId){
+  if (taskId < 0 || taskId >= heap->Capacity)
+    return 0;
+  return heap->Positions[taskId] >= 0;
+}
+
+void IsosHeap_Put(IsosHeap* heap, short taskId, IsosClock due){
+  short index;
+  if (taskId < 0 || taskId >= heap->Capacity)
+    return; //such task cannot be in the heap
+  index = heap->Positions[taskId];
+  if (index < 0){ //new item, put it at the end of the heap first
+    index = heap->Size;
+    heap->Size++;
+  }
+  heap->Items[index].TaskId = taskId;
+  heap->Items[index].Due = due;
+  heap->Positions[taskId] = index;
+  //only one of these will actually move the item, depending on whether the due gets earlier or later
+  IsosHeap_siftUp(heap, index);
+  IsosHeap_siftDown(heap, heap->Positions[taskId]);
+}
+
+void IsosHeap_Remove(IsosHeap* heap, short taskId){
+  short index, movedTaskId;
+  if (!IsosHeap_Contains(heap, taskId))
+    return;
+  index = heap->Positions[taskId];
+  heap->Positions[taskId] = -1;
+  heap->Size--;
+  if (index == heap->Size) //the last item, nothing needs to be moved
+    return;
+  movedTaskId = heap->Items[heap->Size].TaskId;
+  IsosHeap_setItem(heap, index, &heap->Items[heap->Size]); //fills the hole with the last item, then restore the heap order
+  IsosHeap_siftUp(heap, index);
+  IsosHeap_siftDown(heap, heap->Positions[movedTaskId]);
+}
+
+char IsosHeap_Peek(const IsosHeap* heap, short* taskId, IsosClock* due){
+  if (heap->Size <= 0)
+    return 0;
+  *taskId = heap->Items[0].TaskId;
+  *due = heap->Items[0].Due;
+  return 1;
+}
+
+char IsosHeap_Pop(IsosHeap* heap, short* taskId, IsosClock* due){
+  if (!IsosHeap_Peek(heap, taskId, due))
+    return 0;
+  IsosHeap_Remove(heap, *taskId);
+  return 1;
+}
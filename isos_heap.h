@@ -0,0 +1,60 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_heap.c, isos_heap.h
+  - Describe the clock-keyed binary min-heap used in ISOS to index tasks by their (absolute) due time
+  - The earliest due is always on top, so the OS only needs to look at the top to know whether anything is due
+*/
+
+#ifndef ISOS_HEAP_H
+#define ISOS_HEAP_H
+
+#include "isos_clock.h"
+
+typedef struct IsosHeapItemStruct {
+  IsosClock Due; //the (cached) absolute due time of the task, used as the key of the heap
+  short TaskId; //the task index of the item
+} IsosHeapItem;
+
+//The IsosHeap does not own its memory, the items and the positions arrays are given on initialization
+typedef struct IsosHeapStruct {
+  IsosHeapItem* Items; //the heap array, Items[0] always has the earliest due
+  short* Positions; //the position of each task Id in the Items array, -1 if the task is not in the heap
+  short Capacity; //the maximum number of items (and of task Ids) the heap can hold
+  short Size; //the current number of items in the heap
+} IsosHeap;
+
+void IsosHeap_Init(IsosHeap* heap, IsosHeapItem* items, short* positions, short capacity);
+char IsosHeap_Contains(const IsosHeap* heap, short taskId);
+void IsosHeap_Put(IsosHeap* heap, short taskId, IsosClock due); //to insert the task, or to update its due if it is already in the heap
+void IsosHeap_Remove(IsosHeap* heap, short taskId); //does nothing if the task is not in the heap
+char IsosHeap_Peek(const IsosHeap* heap, short* taskId, IsosClock* due); //to see the earliest due task, if the heap is empty, returns 0
+char IsosHeap_Pop(IsosHeap* heap, short* taskId, IsosClock* due); //to take out the earliest due task, if the heap is empty, returns 0
+
+#endif // ISOS_HEAP_H
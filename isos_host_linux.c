@@ -0,0 +1,183 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_host_linux.c, isos_host_linux.h
+  - Provide the tickless host runner of ISOS for Linux (i.e. ground simulation hosts)
+  - Instead of ticking the clock every 1 ms in a busy loop, the runner sleeps until the next deadline of the OS,
+    then advances the main clock by the elapsed (real) time in one step
+  - Run each kernel on its own thread, optionally pinned to a core, so that several kernels run in parallel
+  - If an I/O backend is set, the runner waits for its fds (epoll) instead of sleeping, so the Rx data wakes the OS up right away
+  - If an idle action is set, it is run before every wait (i.e. to drain the trace ring), out of the scheduling path
+  - The wait is ended right away by IsosHostLinux_Stop and by the events set from an ISR (or another thread),
+    through the eventfd of the I/O backend if it is set, otherwise through a condition variable
+*/
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include "isos.h"
+#include "isos_host_linux.h"
+
+static IsosHostLinux HostDefault; //the host of the default kernel, used by IsosHostLinux_Init, IsosHostLinux_RunOnce and IsosHostLinux_Run
+
+long long IsosHostLinux_getElapsedMs(const IsosHostLinux* host){
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (long long)(now.tv_sec - host->StartTime.tv_sec) * MS_PER_S + (now.tv_nsec - host->StartTime.tv_nsec) / 1000000;
+}
+
+//Sleeps until the time or until woken up, whichever comes first
+void IsosHostLinux_sleepUntilMs(IsosHostLinux* host, long long elapsedMs){
+  struct timespec wakeUpTime;
+  wakeUpTime.tv_sec = host->StartTime.tv_sec + elapsedMs / MS_PER_S;
+  wakeUpTime.tv_nsec = host->StartTime.tv_nsec + (elapsedMs % MS_PER_S) * 1000000;
+  if (wakeUpTime.tv_nsec >= 1000000000L){
+    wakeUpTime.tv_sec++;
+    wakeUpTime.tv_nsec -= 1000000000L;
+  }
+  pthread_mutex_lock(&host->WakeUpLock);
+  while (!host->IsWakeUpPending && pthread_cond_timedwait(&host->WakeUpCondition, &host->WakeUpLock, &wakeUpTime) != ETIMEDOUT); //absolute time, so it can simply be restarted on a spurious wake-up
+  host->IsWakeUpPending = 0;
+  pthread_mutex_unlock(&host->WakeUpLock);
+}
+
+//Run on the thread setting the events (or stopping the host), the runner then runs the OS again at once
+void IsosHostLinux_wakeUp(void* argument){
+  IsosHostLinux* host = argument;
+  if (host->Io){
+    IsosIoLinux_WakeUp(host->Io);
+    return;
+  }
+  pthread_mutex_lock(&host->WakeUpLock);
+  host->IsWakeUpPending = 1;
+  pthread_cond_signal(&host->WakeUpCondition);
+  pthread_mutex_unlock(&host->WakeUpLock);
+}
+
+void IsosHostLinux_InitKernel(IsosHostLinux* host, IsosKernel* kernel){
+  IsosClock clock;
+  pthread_condattr_t conditionAttribute;
+  host->Kernel = kernel;
+  clock_gettime(CLOCK_MONOTONIC, &host->StartTime);
+  clock = IsosKernel_GetClock(kernel);
+  host->StartClockMs = IsosClock_ToMs(&clock);
+  ISOS_HOST_RUNNING_SET(host->Running, 0);
+  pthread_mutex_init(&host->WakeUpLock, (void*)0);
+  pthread_condattr_init(&conditionAttribute);
+  pthread_condattr_setclock(&conditionAttribute, CLOCK_MONOTONIC); //the wake-up time is taken from the monotonic clock
+  pthread_cond_init(&host->WakeUpCondition, &conditionAttribute);
+  pthread_condattr_destroy(&conditionAttribute);
+  host->IsWakeUpPending = 0;
+  host->Io = (void*)0;
+  host->IdleAction = (void*)0;
+  host->IdleArgument = (void*)0;
+  IsosKernel_SetWakeUpAction(kernel, IsosHostLinux_wakeUp, host);
+}
+
+void IsosHostLinux_SetKernelIo(IsosHostLinux* host, IsosIoLinux* io){ host->Io = io; }
+
+void IsosHostLinux_SetKernelIdleAction(IsosHostLinux* host, void (*idleAction)(void*), void* argument){
+  host->IdleAction = idleAction;
+  host->IdleArgument = argument;
+}
+
+void IsosHostLinux_RunKernelOnce(IsosHostLinux* host){
+  IsosClock clock;
+  long long clockMs, deadlineMs, elapsedMs, leftMs;
+  IsosKernel_Run(host->Kernel);
+  clock = IsosKernel_GetClock(host->Kernel);
+  clockMs = IsosClock_ToMs(&clock) - host->StartClockMs;
+  deadlineMs = clockMs + HOST_LINUX_MAX_SLEEP_MS;
+  if (IsosKernel_GetNextDeadline(host->Kernel, &clock) && IsosClock_ToMs(&clock) - host->StartClockMs < deadlineMs)
+    deadlineMs = IsosClock_ToMs(&clock) - host->StartClockMs;
+  if (host->IdleAction) //the time it takes is taken from the wait below
+    host->IdleAction(host->IdleArgument);
+  if (host->Io){ //the fds are served even when there is no time to wait
+    leftMs = deadlineMs - IsosHostLinux_getElapsedMs(host); //the (real) time left until the deadline
+    IsosIoLinux_Poll(host->Io, leftMs > 0 ? (int)leftMs : 0);
+  } else if (deadlineMs > clockMs)
+    IsosHostLinux_sleepUntilMs(host, deadlineMs);
+  elapsedMs = IsosHostLinux_getElapsedMs(host) - clockMs; //whatever the sleep is, the main clock follows the real time
+  if (elapsedMs > 0)
+    IsosKernel_AdvanceClock(host->Kernel, (short)(elapsedMs / MS_PER_DAY), (long)(elapsedMs % MS_PER_DAY));
+}
+
+void* IsosHostLinux_runThread(void* argument){
+  IsosHostLinux* host = argument;
+  IsosKernel_SetCurrent(host->Kernel); //so that the Isos_ functions called on this thread work on this kernel
+  while (ISOS_HOST_RUNNING_GET(host->Running))
+    IsosHostLinux_RunKernelOnce(host);
+  return (void*)0;
+}
+
+char IsosHostLinux_StartOnCore(IsosHostLinux* host, int core){
+  pthread_attr_t attribute;
+  cpu_set_t cpuSet;
+  int result;
+  if (pthread_attr_init(&attribute) != 0)
+    return 0;
+  if (core >= 0){ //pins the thread before it starts, so that the kernel never runs on another core
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    pthread_attr_setaffinity_np(&attribute, sizeof(cpuSet), &cpuSet);
+  }
+  ISOS_HOST_RUNNING_SET(host->Running, 1);
+  result = pthread_create(&host->Thread, &attribute, IsosHostLinux_runThread, host);
+  pthread_attr_destroy(&attribute);
+  if (result != 0)
+    ISOS_HOST_RUNNING_SET(host->Running, 0);
+  return result == 0;
+}
+
+void IsosHostLinux_Stop(IsosHostLinux* host){
+  if (!ISOS_HOST_RUNNING_GET(host->Running))
+    return;
+  ISOS_HOST_RUNNING_SET(host->Running, 0);
+  IsosHostLinux_wakeUp(host); //the thread stops right after its current sleep is ended
+  pthread_join(host->Thread, (void**)0);
+}
+
+void IsosHostLinux_Init(){ IsosHostLinux_InitKernel(&HostDefault, IsosKernel_GetDefault()); }
+
+void IsosHostLinux_SetIo(IsosIoLinux* io){ IsosHostLinux_SetKernelIo(&HostDefault, io); }
+
+void IsosHostLinux_SetIdleAction(void (*idleAction)(void*), void* argument){ IsosHostLinux_SetKernelIdleAction(&HostDefault, idleAction, argument); }
+
+void IsosHostLinux_RunOnce(){ IsosHostLinux_RunKernelOnce(&HostDefault); }
+
+void IsosHostLinux_Run(){
+  while (1)
+    IsosHostLinux_RunOnce();
+}
+
+#endif // __linux__
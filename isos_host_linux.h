@@ -0,0 +1,102 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_host_linux.c, isos_host_linux.h
+  - Provide the tickless host runner of ISOS for Linux (i.e. ground simulation hosts)
+  - Instead of ticking the clock every 1 ms in a busy loop, the runner sleeps until the next deadline of the OS,
+    then advances the main clock by the elapsed (real) time in one step
+  - Run each kernel on its own thread, optionally pinned to a core, so that several kernels run in parallel
+  - If an I/O backend is set, the runner waits for its fds (epoll) instead of sleeping, so the Rx data wakes the OS up right away
+  - If an idle action is set, it is run before every wait (i.e. to drain the trace ring), out of the scheduling path
+  - The wait is ended right away by IsosHostLinux_Stop and by the events set from an ISR (or another thread),
+    through the eventfd of the I/O backend if it is set, otherwise through a condition variable
+*/
+
+#ifndef ISOS_HOST_LINUX_H
+#define ISOS_HOST_LINUX_H
+
+#define HOST_LINUX_MAX_SLEEP_MS 1000 //the longest sleep when the OS has nothing to wait for, the wake-ups end it earlier anyway
+
+#if defined(__linux__)
+#include <time.h>
+#include <pthread.h>
+#include "isos.h"
+#include "isos_io_linux.h"
+
+//The running flag is cleared on the thread calling IsosHostLinux_Stop and read on the runner thread
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+typedef atomic_char IsosHostRunning;
+#define ISOS_HOST_RUNNING_SET(running, value) atomic_store_explicit(&(running), (value), memory_order_release)
+#define ISOS_HOST_RUNNING_GET(running) atomic_load_explicit(&(running), memory_order_acquire)
+#elif defined(__GNUC__)
+typedef char IsosHostRunning;
+#define ISOS_HOST_RUNNING_SET(running, value) __atomic_store_n(&(running), (value), __ATOMIC_RELEASE)
+#define ISOS_HOST_RUNNING_GET(running) __atomic_load_n(&(running), __ATOMIC_ACQUIRE)
+#else
+typedef volatile char IsosHostRunning; //no atomics, a plain char is still stored and loaded at once
+#define ISOS_HOST_RUNNING_SET(running, value) ((running) = (value))
+#define ISOS_HOST_RUNNING_GET(running) (running)
+#endif
+
+//One host runs one kernel, several hosts can run several kernels in parallel, each one on its own thread (and core)
+typedef struct IsosHostLinuxStruct {
+  IsosKernel* Kernel; //the kernel run by this host
+  struct timespec StartTime; //the real (monotonic) time which is mapped to the main clock of the kernel at IsosHostLinux_InitKernel
+  long long StartClockMs; //the main clock of the kernel at IsosHostLinux_InitKernel
+  pthread_t Thread; //only used by IsosHostLinux_StartOnCore
+  IsosHostRunning Running; //cleared by IsosHostLinux_Stop to stop the thread
+  pthread_mutex_t WakeUpLock; //guards IsWakeUpPending, the sleep waits on WakeUpCondition when there is no I/O backend
+  pthread_cond_t WakeUpCondition; //on the monotonic clock, like StartTime
+  char IsWakeUpPending; //set by a wake-up which may come before the sleep, so that it is not lost
+  IsosIoLinux* Io; //null if the kernel has no fd-bound resource task
+  void (*IdleAction)(void*); //null if there is nothing to do while the OS waits
+  void* IdleArgument;
+} IsosHostLinux;
+
+void IsosHostLinux_InitKernel(IsosHostLinux* host, IsosKernel* kernel); //to be called after the kernel is initialized
+void IsosHostLinux_SetKernelIo(IsosHostLinux* host, IsosIoLinux* io); //the I/O backend must be initialized for the same kernel
+void IsosHostLinux_SetKernelIdleAction(IsosHostLinux* host, void (*idleAction)(void*), void* argument);
+void IsosHostLinux_RunKernelOnce(IsosHostLinux* host);
+char IsosHostLinux_StartOnCore(IsosHostLinux* host, int core); //runs the kernel on a new thread pinned to the core (-1: any core), returns 0 if failed
+void IsosHostLinux_Stop(IsosHostLinux* host); //stops the thread started by IsosHostLinux_StartOnCore and waits for it
+#endif // __linux__
+
+//Runner of the default kernel
+void IsosHostLinux_Init(); //to be called after Isos_Init, the real time from now on is mapped to the main clock
+#if defined(__linux__)
+void IsosHostLinux_SetIo(IsosIoLinux* io);
+#endif // __linux__
+//The idle action is run on the runner thread, after the OS is run and before the runner waits for the next deadline
+//It should be short (i.e. draining the trace ring of the kernel, see IsosTraceRing_Drain), the time it takes delays the wait, not the OS
+void IsosHostLinux_SetIdleAction(void (*idleAction)(void*), void* argument);
+void IsosHostLinux_RunOnce(); //runs the OS once, then sleeps until the next deadline and advances the main clock
+void IsosHostLinux_Run(); //never returns
+
+#endif // ISOS_HOST_LINUX_H
@@ -0,0 +1,226 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_io_linux.c, isos_io_linux.h
+  - Provide the file-descriptor I/O backend of ISOS for Linux (i.e. ground simulation hosts and hardware-in-the-loop rigs)
+  - Bind a resource task to a file descriptor (UART, pty, pipe, socketpair, etc), so that its Rx/Tx buffers are fed by the fd directly
+  - The Rx buffer is filled in bulk with readv when the fd is readable (and the claimed resource task is made due),
+    the Tx buffer is drained in bulk with writev when the fd is writable, both in place with the buffer spans (no extra copy)
+  - One epoll loop serves all the bound fds of a kernel, run on the kernel thread (i.e. by the tickless host runner as its sleep),
+    so the buffers are never touched by two threads at the same time
+  - Writing to a closed pipe or socket raises SIGPIPE, the application is expected to ignore it (the fd is then simply unbound)
+  - An eventfd is polled along with the bound fds, so that another thread (or a signal handler) can end the poll right away
+*/
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include "isos.h"
+#include "isos_io_linux.h"
+
+short IsosIoLinux_spanToIovec(IsosBufferSpan* span, struct iovec* iov){
+  short i, size = 0;
+  for (i = 0; i < 2; ++i)
+    if (span->RegionSizes[i] > 0){
+      iov[size].iov_base = span->Regions[i];
+      iov[size].iov_len = span->RegionSizes[i];
+      size++;
+    }
+  return size;
+}
+
+unsigned int IsosIoLinux_getWantedEvents(const IsosIoLinuxBinding* binding){
+  unsigned int events = 0;
+  if (binding->RxBuffer && IsosBuffer_GetDataSize(binding->RxBuffer) < binding->RxBuffer->BufferSize)
+    events |= EPOLLIN; //a full Rx buffer is not polled, otherwise the (level-triggered) fd keeps reporting the data it cannot take
+  if (binding->TxBuffer && IsosBuffer_GetDataSize(binding->TxBuffer) > 0)
+    events |= EPOLLOUT; //an empty Tx buffer is not polled, otherwise a writable fd is reported all the time
+  return events;
+}
+
+void IsosIoLinux_closeBinding(IsosIoLinux* io, IsosIoLinuxBinding* binding){
+  epoll_ctl(io->EpollFd, EPOLL_CTL_DEL, binding->Fd, (void*)0);
+  binding->Closed = 1;
+}
+
+void IsosIoLinux_updateEvents(IsosIoLinux* io, IsosIoLinuxBinding* binding){
+  struct epoll_event event;
+  unsigned int events;
+  events = IsosIoLinux_getWantedEvents(binding);
+  if (binding->Closed || events == binding->Events)
+    return; //nothing changes, no system call
+  event.events = events;
+  event.data.u32 = (unsigned int)(binding - io->Bindings);
+  if (epoll_ctl(io->EpollFd, EPOLL_CTL_MOD, binding->Fd, &event) == 0)
+    binding->Events = events;
+}
+
+//Reads as much as the Rx buffer can take, returns 0 if the fd has reached its end or failed
+char IsosIoLinux_readRx(IsosIoLinux* io, IsosIoLinuxBinding* binding){
+  IsosBufferSpan span;
+  struct iovec iov[2];
+  ssize_t readSize;
+  char hasRead = 0, result = 1;
+  while (IsosBuffer_ReserveWrite(binding->RxBuffer, &span, 0) > 0){
+    readSize = readv(binding->Fd, iov, IsosIoLinux_spanToIovec(&span, iov));
+    if (readSize < 0 && errno == EINTR)
+      continue;
+    if (readSize <= 0){ //0 is the end of the fd (i.e. the writer is closed)
+      result = readSize < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+      break;
+    }
+    IsosBuffer_CommitWrite(binding->RxBuffer, (short)readSize);
+    hasRead = 1;
+    if (readSize < span.Size) //the fd has no more data for now
+      break;
+  }
+  if (hasRead) //once for all the data read
+    IsosKernel_NotifyResourceTaskRx(io->Kernel, binding->Type);
+  return result;
+}
+
+//Writes as much of the Tx data as the fd can take, returns 0 if the fd failed
+char IsosIoLinux_writeTx(IsosIoLinuxBinding* binding){
+  IsosBufferSpan span;
+  struct iovec iov[2];
+  ssize_t writtenSize;
+  while (IsosBuffer_PeekRead(binding->TxBuffer, &span, 0) > 0){
+    writtenSize = writev(binding->Fd, iov, IsosIoLinux_spanToIovec(&span, iov));
+    if (writtenSize < 0 && errno == EINTR)
+      continue;
+    if (writtenSize < 0)
+      return errno == EAGAIN || errno == EWOULDBLOCK; //the fd is full, the rest is written once it is writable
+    IsosBuffer_ConsumeRead(binding->TxBuffer, (short)writtenSize);
+    if (writtenSize < span.Size)
+      break;
+  }
+  return 1;
+}
+
+char IsosIoLinux_Init(IsosIoLinux* io, IsosKernel* kernel){
+  struct epoll_event event;
+  io->Kernel = kernel;
+  io->BindingSize = 0;
+  io->EpollFd = epoll_create1(EPOLL_CLOEXEC);
+  io->WakeUpFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  event.events = EPOLLIN;
+  event.data.u32 = IO_LINUX_MAX_BINDING_SIZE; //never the index of a binding
+  if (io->EpollFd < 0 || io->WakeUpFd < 0 || epoll_ctl(io->EpollFd, EPOLL_CTL_ADD, io->WakeUpFd, &event) != 0){
+    IsosIoLinux_Close(io);
+    return 0;
+  }
+  return 1;
+}
+
+char IsosIoLinux_Bind(IsosIoLinux* io, IsosResourceTaskType type, int fd){
+  IsosIoLinuxBinding* binding;
+  struct epoll_event event;
+  char result;
+  int flags;
+  if (io->BindingSize >= IO_LINUX_MAX_BINDING_SIZE || fd < 0)
+    return 0;
+  binding = &io->Bindings[io->BindingSize];
+  binding->TxBuffer = IsosKernel_GetResourceTaskBuffer(io->Kernel, &result, type, 1);
+  binding->RxBuffer = IsosKernel_GetResourceTaskBuffer(io->Kernel, &result, type, 0);
+  if (!binding->TxBuffer && !binding->RxBuffer)
+    return 0; //not a registered resource task, or one without any buffer to be fed
+  flags = fcntl(fd, F_GETFL);
+  if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    return 0;
+  binding->Fd = fd;
+  binding->Type = type;
+  binding->Closed = 0;
+  binding->Events = IsosIoLinux_getWantedEvents(binding);
+  event.events = binding->Events;
+  event.data.u32 = (unsigned int)io->BindingSize;
+  if (epoll_ctl(io->EpollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+    return 0;
+  io->BindingSize++;
+  return 1;
+}
+
+void IsosIoLinux_Poll(IsosIoLinux* io, int timeoutMs){
+  struct epoll_event events[IO_LINUX_MAX_EVENT_SIZE];
+  IsosIoLinuxBinding* binding;
+  eventfd_t wakeUpCount;
+  int i, eventSize;
+  char ok;
+  for (i = 0; i < io->BindingSize; ++i){ //the Tx data prepared since the last poll is written right away, the fd is most likely writable
+    binding = &io->Bindings[i];
+    if (binding->Closed)
+      continue;
+    if (binding->TxBuffer && IsosBuffer_GetDataSize(binding->TxBuffer) > 0 && !IsosIoLinux_writeTx(binding)){
+      IsosIoLinux_closeBinding(io, binding);
+      continue;
+    }
+    IsosIoLinux_updateEvents(io, binding); //the Rx buffer may have been read by the resource task since the last poll
+  }
+  eventSize = epoll_wait(io->EpollFd, events, IO_LINUX_MAX_EVENT_SIZE, timeoutMs < 0 ? 0 : timeoutMs);
+  for (i = 0; i < eventSize; ++i){ //if interrupted (negative), simply returns, the caller polls again
+    if (events[i].data.u32 == IO_LINUX_MAX_BINDING_SIZE){ //woken up, the counter is reset so that the next poll waits again
+      while (read(io->WakeUpFd, &wakeUpCount, sizeof(wakeUpCount)) < 0 && errno == EINTR);
+      continue;
+    }
+    binding = &io->Bindings[events[i].data.u32];
+    if (binding->Closed)
+      continue;
+    ok = 1;
+    if (binding->RxBuffer && (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+      ok = IsosIoLinux_readRx(io, binding); //on hang up, the remaining data is read first
+    if (ok && binding->TxBuffer && (events[i].events & (EPOLLOUT | EPOLLERR)))
+      ok = IsosIoLinux_writeTx(binding);
+    if (!ok || (events[i].events & (EPOLLHUP | EPOLLERR))) //hang up and error are always reported, even when nothing is polled
+      IsosIoLinux_closeBinding(io, binding);
+    else
+      IsosIoLinux_updateEvents(io, binding);
+  }
+}
+
+//Only write is used, which is async-signal-safe, the counter simply adds up until the poll reads it
+void IsosIoLinux_WakeUp(IsosIoLinux* io){
+  eventfd_t one = 1;
+  while (write(io->WakeUpFd, &one, sizeof(one)) < 0 && errno == EINTR);
+}
+
+void IsosIoLinux_Close(IsosIoLinux* io){
+  if (io->EpollFd >= 0)
+    close(io->EpollFd);
+  if (io->WakeUpFd >= 0)
+    close(io->WakeUpFd);
+  io->EpollFd = -1;
+  io->WakeUpFd = -1;
+  io->BindingSize = 0;
+}
+
+#endif // __linux__
@@ -0,0 +1,75 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_io_linux.c, isos_io_linux.h
+  - Provide the file-descriptor I/O backend of ISOS for Linux (i.e. ground simulation hosts and hardware-in-the-loop rigs)
+  - Bind a resource task to a file descriptor (UART, pty, pipe, socketpair, etc), so that its Rx/Tx buffers are fed by the fd directly
+  - The Rx buffer is filled in bulk with readv when the fd is readable (and the claimed resource task is made due),
+    the Tx buffer is drained in bulk with writev when the fd is writable, both in place with the buffer spans (no extra copy)
+  - One epoll loop serves all the bound fds of a kernel, run on the kernel thread (i.e. by the tickless host runner as its sleep),
+    so the buffers are never touched by two threads at the same time
+  - Writing to a closed pipe or socket raises SIGPIPE, the application is expected to ignore it (the fd is then simply unbound)
+  - An eventfd is polled along with the bound fds, so that another thread (or a signal handler) can end the poll right away
+*/
+
+#ifndef ISOS_IO_LINUX_H
+#define ISOS_IO_LINUX_H
+
+#define IO_LINUX_MAX_BINDING_SIZE 16 //the most fds bound to one I/O backend
+#define IO_LINUX_MAX_EVENT_SIZE 16 //the most fd events handled in one poll
+
+#if defined(__linux__)
+#include "isos.h"
+
+typedef struct IsosIoLinuxBindingStruct {
+  int Fd; //not owned by the binding, it is never closed here
+  IsosResourceTaskType Type;
+  IsosBuffer* TxBuffer; //null if the resource task has no Tx buffer
+  IsosBuffer* RxBuffer; //null if the resource task has no Rx buffer
+  unsigned int Events; //the epoll events currently polled: EPOLLIN only while the Rx buffer has free space, EPOLLOUT only while the Tx buffer has data
+  char Closed; //the fd is hung up or failed, it is no longer polled
+} IsosIoLinuxBinding;
+
+//One I/O backend serves one kernel
+typedef struct IsosIoLinuxStruct {
+  IsosKernel* Kernel;
+  int EpollFd;
+  int WakeUpFd; //the eventfd written by IsosIoLinux_WakeUp, reported with the binding index IO_LINUX_MAX_BINDING_SIZE
+  IsosIoLinuxBinding Bindings[IO_LINUX_MAX_BINDING_SIZE];
+  short BindingSize;
+} IsosIoLinux;
+
+char IsosIoLinux_Init(IsosIoLinux* io, IsosKernel* kernel); //to be called after the kernel is initialized, returns 0 if failed
+char IsosIoLinux_Bind(IsosIoLinux* io, IsosResourceTaskType type, int fd); //the resource task must be registered with buffer(s), the fd is made non-blocking, returns 0 if failed
+void IsosIoLinux_Poll(IsosIoLinux* io, int timeoutMs); //writes the pending Tx data, then waits up to timeoutMs (0: does not wait) for the fds and serves them
+void IsosIoLinux_WakeUp(IsosIoLinux* io); //ends the current (or the next) wait of IsosIoLinux_Poll, may be called on any thread
+void IsosIoLinux_Close(IsosIoLinux* io); //the bound fds are not closed
+#endif // __linux__
+
+#endif // ISOS_IO_LINUX_H
@@ -0,0 +1,54 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_profile.c, isos_profile.h
+  - Describe the (optional) profiling counters of ISOS, used to measure the overhead of the OS itself
+  - Compiled out completely unless ISOS_PROFILING is set to 1 (i.e. by the Benchmark build target)
+*/
+
+#include "isos_profile.h"
+
+#if ISOS_PROFILING
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif // defined
+#include <time.h>
+
+long long IsosProfile_GetNs(){
+  struct timespec now;
+  #if defined(__linux__)
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  #else
+  timespec_get(&now, TIME_UTC); //C11, used where there is no monotonic clock
+  #endif // defined
+  return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+#endif // ISOS_PROFILING
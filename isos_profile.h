@@ -0,0 +1,59 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_profile.c, isos_profile.h
+  - Describe the (optional) profiling counters of ISOS, used to measure the overhead of the OS itself
+  - Compiled out completely unless ISOS_PROFILING is set to 1 (i.e. by the Benchmark build target)
+*/
+
+#ifndef ISOS_PROFILE_H
+#define ISOS_PROFILE_H
+
+#ifndef ISOS_PROFILING
+#define ISOS_PROFILING 0 //set to 1 to let the OS accumulate the time it spends in its own functions (costs two clock readings per measured call)
+#endif // ISOS_PROFILING
+
+typedef struct IsosProfileStruct {
+  long long SchedulerNs; //time spent in Isos_scheduler, checking the next-due index and queueing the due tasks
+  long long ReadyQueueNs; //time spent in taking the next task to run and re-queueing it (what used to be the sorting of the due list)
+  long long ExecuteNs; //time spent in Isos_execute, including the task actions
+  long long SchedulerRuns; //number of times the scheduler is run
+  long long Dispatches; //number of tasks taken from the ready queue to be executed
+} IsosProfile;
+
+#if ISOS_PROFILING
+long long IsosProfile_GetNs(); //monotonic time in ns, only the differences are meaningful
+#define ISOS_PROFILE_START(startNs) (startNs) = IsosProfile_GetNs()
+#define ISOS_PROFILE_STOP(totalNs, startNs) (totalNs) += IsosProfile_GetNs() - (startNs)
+#else
+#define ISOS_PROFILE_START(startNs)
+#define ISOS_PROFILE_STOP(totalNs, startNs)
+#endif // ISOS_PROFILING
+
+#endif // ISOS_PROFILE_H
@@ -1,11 +0,0 @@
-/* Base code taken from: https://www.geeksforgeeks.org/quick-sort/*/
-/* Modified by Ian K for use in ISOS */
-/* C implementation Isos_QuickSort ASC and DESC */
-
-#ifndef ISOS_QUICKSORT_H
-#define ISOS_QUICKSORT_H
-
-void Isos_QuickSortAsc(IsosDueTask arr[], int low, int high);
-void Isos_QuickSortDesc(IsosDueTask arr[], int low, int high);
-
-#endif
@@ -0,0 +1,146 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_ready_queue.c, isos_ready_queue.h
+  - Describe the ready queue used in ISOS to hold the due tasks
+  - One FIFO per priority level plus a bitmap of the non-empty levels, so that queueing, removing
+    and picking the highest priority task are all done in constant time
+*/
+
+#include <string.h>
+#include "isos_ready_queue.h"
+
+void IsosReadyQueue_InitLinks(IsosReadyQueueLink* links, short linkSize){
+  short i;
+  for (i = 0; i < linkSize; ++i){
+    links[i].Next = -1;
+    links[i].Prev = -1;
+    links[i].Priority = MIN_PRIORITY;
+    links[i].Queue = (void*)0; //not queued anywhere
+  }
+}
+
+void IsosReadyQueue_Init(IsosReadyQueue* queue, IsosReadyQueueLink* links){
+  memset(queue->Bitmap, 0, sizeof(queue->Bitmap));
+  memset(queue->Heads, -1, sizeof(queue->Heads));
+  memset(queue->Tails, -1, sizeof(queue->Tails));
+  queue->Links = links;
+  queue->Size = 0;
+}
+
+//Find-last-set: the index of the highest raised bit of a non-zero word
+short IsosReadyQueue_getHighestBit(unsigned long word){
+  #if defined(__GNUC__)
+  return (short)(sizeof(unsigned long) * 8 - 1) - __builtin_clzl(word);
+  #else
+  short bit = 0;
+  if (word & 0xFFFF0000UL){ word >>= 16; bit += 16; }
+  if (word & 0xFF00UL){ word >>= 8; bit += 8; }
+  if (word & 0xF0UL){ word >>= 4; bit += 4; }
+  if (word & 0xCUL){ word >>= 2; bit += 2; }
+  if (word & 0x2UL){ bit += 1; }
+  return bit;
+  #endif
+}
+
+char IsosReadyQueue_Contains(const IsosReadyQueue* queue, short taskId){
+  return taskId >= 0 && queue->Links[taskId].Queue == queue;
+}
+
+void IsosReadyQueue_Push(IsosReadyQueue* queue, short taskId, unsigned char priority){
+  IsosReadyQueueLink* link;
+  if (taskId < 0 || queue->Links[taskId].Queue) //cannot be queued twice
+    return;
+  if (priority > MAX_PRIORITY) //just to be safe, the priority level cannot be outside the queue
+    priority = MAX_PRIORITY;
+  link = &queue->Links[taskId];
+  link->Priority = priority;
+  link->Queue = queue;
+  link->Next = -1;
+  link->Prev = queue->Tails[priority];
+  if (link->Prev >= 0)
+    queue->Links[link->Prev].Next = taskId;
+  else { //the level was empty
+    queue->Heads[priority] = taskId;
+    queue->Bitmap[priority / READY_QUEUE_BITS_PER_WORD] |= 1UL << (priority % READY_QUEUE_BITS_PER_WORD);
+  }
+  queue->Tails[priority] = taskId;
+  queue->Size++;
+}
+
+char IsosReadyQueue_Remove(IsosReadyQueue* queue, short taskId){
+  IsosReadyQueueLink* link;
+  unsigned char priority;
+  if (!IsosReadyQueue_Contains(queue, taskId))
+    return 0;
+  link = &queue->Links[taskId];
+  priority = link->Priority;
+  if (link->Prev >= 0)
+    queue->Links[link->Prev].Next = link->Next;
+  else
+    queue->Heads[priority] = link->Next;
+  if (link->Next >= 0)
+    queue->Links[link->Next].Prev = link->Prev;
+  else
+    queue->Tails[priority] = link->Prev;
+  if (queue->Heads[priority] < 0) //the level becomes empty
+    queue->Bitmap[priority / READY_QUEUE_BITS_PER_WORD] &= ~(1UL << (priority % READY_QUEUE_BITS_PER_WORD));
+  link->Next = -1;
+  link->Prev = -1;
+  link->Queue = (void*)0;
+  queue->Size--;
+  return 1;
+}
+
+short IsosReadyQueue_PeekHighest(const IsosReadyQueue* queue){
+  short i;
+  for (i = READY_QUEUE_BITMAP_SIZE - 1; i >= 0; --i) //constant, at most READY_QUEUE_BITMAP_SIZE words to check
+    if (queue->Bitmap[i])
+      return queue->Heads[i * READY_QUEUE_BITS_PER_WORD + IsosReadyQueue_getHighestBit(queue->Bitmap[i])];
+  return -1; //empty queue
+}
+
+short IsosReadyQueue_PopHighest(IsosReadyQueue* queue){
+  short taskId;
+  taskId = IsosReadyQueue_PeekHighest(queue);
+  IsosReadyQueue_Remove(queue, taskId);
+  return taskId;
+}
+
+short IsosReadyQueue_Snapshot(const IsosReadyQueue* queue, IsosDueTask* dueTasks){
+  short priority, taskId, size = 0;
+  //ascending order: the task to be run first (the oldest of the highest priority level) is the last one in the list
+  for (priority = 0; priority < READY_QUEUE_LEVEL_SIZE; ++priority)
+    for (taskId = queue->Tails[priority]; taskId >= 0; taskId = queue->Links[taskId].Prev){
+      dueTasks[size].TaskId = taskId;
+      dueTasks[size].Priority = (unsigned char)priority;
+      size++;
+    }
+  return size;
+}
@@ -0,0 +1,77 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_ready_queue.c, isos_ready_queue.h
+  - Describe the ready queue used in ISOS to hold the due tasks
+  - One FIFO per priority level plus a bitmap of the non-empty levels, so that queueing, removing
+    and picking the highest priority task are all done in constant time
+*/
+
+#ifndef ISOS_READY_QUEUE_H
+#define ISOS_READY_QUEUE_H
+
+#include "isos_task.h"
+
+#define READY_QUEUE_LEVEL_SIZE (MAX_PRIORITY + 1) //one level per priority, from MIN_PRIORITY to MAX_PRIORITY
+#define READY_QUEUE_BITS_PER_WORD 32 //only the lowest 32 bits of each bitmap word are used, whatever the size of unsigned long is
+#define READY_QUEUE_BITMAP_SIZE ((READY_QUEUE_LEVEL_SIZE + READY_QUEUE_BITS_PER_WORD - 1) / READY_QUEUE_BITS_PER_WORD)
+
+typedef struct IsosDueTaskStruct {
+  short TaskId; //the task index of the due task
+  unsigned char Priority; //the task priority of the due task
+} IsosDueTask;
+
+struct IsosReadyQueueStruct;
+
+//The links are shared by all the ready queues, since a task can only be queued in one of them at any given time
+typedef struct IsosReadyQueueLinkStruct {
+  short Next; //the next (younger) task Id on the same priority level, -1 if none
+  short Prev; //the previous (older) task Id on the same priority level, -1 if none
+  unsigned char Priority; //the priority level on which the task is queued
+  struct IsosReadyQueueStruct* Queue; //the queue in which the task is currently queued, null if none
+} IsosReadyQueueLink;
+
+typedef struct IsosReadyQueueStruct {
+  unsigned long Bitmap[READY_QUEUE_BITMAP_SIZE]; //bit n is raised when priority level n has at least one task
+  short Heads[READY_QUEUE_LEVEL_SIZE]; //the first (oldest) task Id of each priority level, -1 if none
+  short Tails[READY_QUEUE_LEVEL_SIZE]; //the last (youngest) task Id of each priority level, -1 if none
+  IsosReadyQueueLink* Links; //the links of all tasks, indexed by the task Id
+  short Size; //the number of tasks currently queued
+} IsosReadyQueue;
+
+void IsosReadyQueue_InitLinks(IsosReadyQueueLink* links, short linkSize);
+void IsosReadyQueue_Init(IsosReadyQueue* queue, IsosReadyQueueLink* links);
+char IsosReadyQueue_Contains(const IsosReadyQueue* queue, short taskId);
+void IsosReadyQueue_Push(IsosReadyQueue* queue, short taskId, unsigned char priority); //to queue the task at the end of its priority level
+char IsosReadyQueue_Remove(IsosReadyQueue* queue, short taskId); //if the task is not in this queue, returns 0
+short IsosReadyQueue_PeekHighest(const IsosReadyQueue* queue); //the oldest task of the highest priority level, -1 if the queue is empty
+short IsosReadyQueue_PopHighest(IsosReadyQueue* queue); //like peek, but removes the task from the queue
+short IsosReadyQueue_Snapshot(const IsosReadyQueue* queue, IsosDueTask* dueTasks); //lists the queue in ascending priority order, mainly for debugging
+
+#endif // ISOS_READY_QUEUE_H
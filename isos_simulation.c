@@ -0,0 +1,96 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_simulation.c, isos_simulation.h
+  - Provide the fast-forward (discrete-event) simulation driver of ISOS, i.e. to run long mission scenarios on the ground
+  - Instead of ticking the clock every 1 ms and running the OS on every tick, the driver jumps the main clock straight to
+    the next instant on which anything can change: the next scheduler run with something to do, or the next external stimulus
+  - The clock only stops where a 1 ms tick loop would have run the scheduler with something to do, so the scheduling decisions are the same
+  - The external stimuli (i.e. the simulated ISRs) are scheduled on the virtual clock, they are fired before the OS runs on the same instant
+*/
+
+#include "isos_simulation.h"
+
+void IsosSimulation_Init(IsosSimulation* simulation, IsosKernel* kernel){
+  simulation->Kernel = kernel;
+  IsosHeap_Init(&simulation->StimulusHeap, simulation->StimulusHeapItems, simulation->StimulusHeapPositions, SIMULATION_MAX_STIMULUS_SIZE);
+  simulation->RunSize = 0;
+}
+
+char IsosSimulation_Schedule(IsosSimulation* simulation, short day, long ms, void (*action)(IsosSimulation*, void*), void* argument){
+  short i;
+  for (i = 0; i < SIMULATION_MAX_STIMULUS_SIZE; ++i)
+    if (!IsosHeap_Contains(&simulation->StimulusHeap, i)){
+      simulation->Stimuli[i].Action = action;
+      simulation->Stimuli[i].Argument = argument;
+      IsosHeap_Put(&simulation->StimulusHeap, i, IsosClock_Create(day, ms));
+      return 1;
+    }
+  return 0; //no more free slot
+}
+
+//Fires the stimuli which are due by now, a stimulus may schedule others, even on the same clock
+void IsosSimulation_fireStimuli(IsosSimulation* simulation){
+  IsosClock mainClock, due;
+  short stimulusId;
+  mainClock = IsosKernel_GetClock(simulation->Kernel);
+  while (IsosHeap_Peek(&simulation->StimulusHeap, &stimulusId, &due)){
+    if (IsosClock_Compare(&mainClock, &due) < 0)
+      break;
+    IsosHeap_Pop(&simulation->StimulusHeap, &stimulusId, &due); //the slot is free again before the action is called
+    simulation->Stimuli[stimulusId].Action(simulation, simulation->Stimuli[stimulusId].Argument);
+  }
+}
+
+//On every instant the driver stops at, the OS is only run if the scheduler would have something to do on it (a stimulus may stop the driver
+//between two scheduler runs of the tick loop, where running the OS would move the scheduler runs), then the clock jumps to the next instant
+void IsosSimulation_RunUntil(IsosSimulation* simulation, short endDay, long endMs){
+  IsosClock mainClock, endClock, nextClock, clock;
+  short stimulusId;
+  long long elapsedMs;
+  endClock = IsosClock_Create(endDay, endMs);
+  mainClock = IsosKernel_GetClock(simulation->Kernel);
+  while (IsosClock_Compare(&mainClock, &endClock) <= 0){
+    IsosSimulation_fireStimuli(simulation);
+    if (IsosKernel_GetNextTickDeadline(simulation->Kernel, &clock) && IsosClock_Compare(&clock, &mainClock) <= 0){
+      IsosKernel_Run(simulation->Kernel);
+      simulation->RunSize++;
+    }
+    nextClock = endClock; //nothing to do at all, the driver simply finishes
+    if (IsosKernel_GetNextTickDeadline(simulation->Kernel, &clock) && IsosClock_Compare(&clock, &nextClock) < 0)
+      nextClock = clock;
+    if (IsosHeap_Peek(&simulation->StimulusHeap, &stimulusId, &clock) && IsosClock_Compare(&clock, &nextClock) < 0)
+      nextClock = clock;
+    elapsedMs = IsosClock_ToMs(&nextClock) - IsosClock_ToMs(&mainClock);
+    if (elapsedMs < 1)
+      elapsedMs = 1;
+    IsosKernel_AdvanceClock(simulation->Kernel, (short)(elapsedMs / MS_PER_DAY), (long)(elapsedMs % MS_PER_DAY));
+    mainClock = IsosKernel_GetClock(simulation->Kernel);
+  }
+}
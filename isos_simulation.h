@@ -0,0 +1,67 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_simulation.c, isos_simulation.h
+  - Provide the fast-forward (discrete-event) simulation driver of ISOS, i.e. to run long mission scenarios on the ground
+  - Instead of ticking the clock every 1 ms and running the OS on every tick, the driver jumps the main clock straight to
+    the next instant on which anything can change: the next scheduler run with something to do, or the next external stimulus
+  - The clock only stops where a 1 ms tick loop would have run the scheduler with something to do, so the scheduling decisions are the same
+  - The external stimuli (i.e. the simulated ISRs) are scheduled on the virtual clock, they are fired before the OS runs on the same instant
+*/
+
+#ifndef ISOS_SIMULATION_H
+#define ISOS_SIMULATION_H
+
+#include "isos.h"
+
+#define SIMULATION_MAX_STIMULUS_SIZE 32 //the most stimuli scheduled at once
+
+struct IsosSimulationStruct;
+
+typedef struct IsosSimulationStimulusStruct {
+  void (*Action)(struct IsosSimulationStruct*, void*); //called with the simulation (i.e. to schedule the next stimulus) and the argument
+  void* Argument;
+} IsosSimulationStimulus;
+
+//One simulation drives one kernel, the stimuli are indexed by their due (the earliest on top) like the tasks in the next-due index
+typedef struct IsosSimulationStruct {
+  IsosKernel* Kernel; //the kernel driven by this simulation
+  IsosSimulationStimulus Stimuli[SIMULATION_MAX_STIMULUS_SIZE];
+  IsosHeapItem StimulusHeapItems[SIMULATION_MAX_STIMULUS_SIZE];
+  short StimulusHeapPositions[SIMULATION_MAX_STIMULUS_SIZE];
+  IsosHeap StimulusHeap; //the scheduled stimuli, a stimulus slot is free when it is not in the heap
+  long long RunSize; //the number of times the OS has been run, to compare with the number of ms simulated
+} IsosSimulation;
+
+void IsosSimulation_Init(IsosSimulation* simulation, IsosKernel* kernel); //to be called after the kernel is initialized
+//To call the action once the main clock reaches the given (absolute) clock, returns 0 if there is no more room for the stimulus
+char IsosSimulation_Schedule(IsosSimulation* simulation, short day, long ms, void (*action)(IsosSimulation*, void*), void* argument);
+void IsosSimulation_RunUntil(IsosSimulation* simulation, short endDay, long endMs); //runs the OS up to (and including) the given clock
+
+#endif // ISOS_SIMULATION_H
@@ -0,0 +1,154 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_spsc_buffer.c, isos_spsc_buffer.h
+  - Describe the single-producer/single-consumer (SPSC) variant of the IsosBuffer, used when the producer and the consumer
+    run concurrently (i.e. an ISR or a reader thread on one side and a task on the other side)
+  - The producer only writes the put index and the consumer only writes the get index, there is no shared data size,
+    so every function is wait-free without any lock
+  - Like the IsosBuffer, the buffer is circular
+*/
+
+#include <string.h>
+#include "isos_spsc_buffer.h"
+
+//From an index (0 to 2 * BufferSize - 1) to its position in the buffer, no division is needed
+int IsosSpscBuffer_toPosition(const IsosSpscBuffer* spscBuffer, int index){
+  return index >= spscBuffer->BufferSize ? index - spscBuffer->BufferSize : index;
+}
+
+int IsosSpscBuffer_advanceIndex(const IsosSpscBuffer* spscBuffer, int index, short itemSize){
+  index += itemSize;
+  return index >= 2 * spscBuffer->BufferSize ? index - 2 * spscBuffer->BufferSize : index;
+}
+
+short IsosSpscBuffer_getDataSize(const IsosSpscBuffer* spscBuffer, int putIndex, int getIndex){
+  int dataSize = putIndex - getIndex;
+  return (short)(dataSize < 0 ? dataSize + 2 * spscBuffer->BufferSize : dataSize);
+}
+
+void IsosSpscBuffer_Init(IsosSpscBuffer* spscBuffer, unsigned char* buffer, short bufferSize){
+  spscBuffer->Buffer = buffer;
+  spscBuffer->BufferSize = bufferSize; //buffer size info should be provided
+  spscBuffer->ExpectedDataSize = 0;
+  memset(buffer, 0, bufferSize); //set everything to zero
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->PutIndex, 0);
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->GetIndex, 0);
+}
+
+short IsosSpscBuffer_GetDataSize(IsosSpscBuffer* spscBuffer){
+  return IsosSpscBuffer_getDataSize(spscBuffer, ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->PutIndex), ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->GetIndex));
+}
+
+//Expected to be used by ISR (or reader thread) to put Rx data one-by-one in the buffer for later-retrieval
+char IsosSpscBuffer_Put(IsosSpscBuffer* spscBuffer, unsigned char item){
+  int putIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->PutIndex); //own index, no need to synchronize
+  int getIndex = ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->GetIndex); //the consumer must be done with the space before it is reused
+  if (IsosSpscBuffer_getDataSize(spscBuffer, putIndex, getIndex) >= spscBuffer->BufferSize) //buffer is full! nothing can be put anymore
+    return 0;
+  spscBuffer->Buffer[IsosSpscBuffer_toPosition(spscBuffer, putIndex)] = item;
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->PutIndex, IsosSpscBuffer_advanceIndex(spscBuffer, putIndex, 1)); //publishes the item
+  return 1; //successful
+}
+
+//Expected to be used by resource task to put all Tx data in the buffer before starting the transmission
+char IsosSpscBuffer_Puts(IsosSpscBuffer* spscBuffer, unsigned char* items, short itemSize){
+  int putIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->PutIndex);
+  int getIndex = ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->GetIndex);
+  short position, copySize;
+  if (itemSize <= 0 || IsosSpscBuffer_getDataSize(spscBuffer, putIndex, getIndex) + itemSize > spscBuffer->BufferSize) //will overflow if continued!
+    return 0; //unsuccessful
+  position = (short)IsosSpscBuffer_toPosition(spscBuffer, putIndex);
+  copySize = spscBuffer->BufferSize - position < itemSize ? spscBuffer->BufferSize - position : itemSize;
+  memcpy(&spscBuffer->Buffer[position], items, copySize); //copy to segment from this current index to the last index
+  if (copySize < itemSize) //if it will overflow, copy for the second time
+    memcpy(spscBuffer->Buffer, &items[copySize], itemSize - copySize);
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->PutIndex, IsosSpscBuffer_advanceIndex(spscBuffer, putIndex, itemSize)); //publishes all items at once
+  return 1;
+}
+
+void IsosSpscBuffer_Flush(IsosSpscBuffer* spscBuffer){
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->GetIndex, ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->PutIndex)); //get index equal to put index
+}
+
+char IsosSpscBuffer_Peek(IsosSpscBuffer* spscBuffer, unsigned char* item){
+  int getIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->GetIndex);
+  if (getIndex == ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->PutIndex)) //nothing in the buffer
+    return 0;
+  *item = spscBuffer->Buffer[IsosSpscBuffer_toPosition(spscBuffer, getIndex)];
+  return 1; //successful
+}
+
+//Expected to be used by ISR (or writer thread) to get Tx data one-by-one from the buffer for transmission
+char IsosSpscBuffer_Get(IsosSpscBuffer* spscBuffer, unsigned char* item){
+  int getIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->GetIndex);
+  if (!IsosSpscBuffer_Peek(spscBuffer, item))
+    return 0;
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->GetIndex, IsosSpscBuffer_advanceIndex(spscBuffer, getIndex, 1)); //gives the space back to the producer
+  return 1; //successful
+}
+
+//If minItemSize is non-positive, then all data will be retrieved
+//If minItemSize is positive, then only get minItemSize data if the data size in the buffer >= minItemSize
+short IsosSpscBuffer_Peeks(IsosSpscBuffer* spscBuffer, unsigned char* items, short minItemSize){
+  int getIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->GetIndex);
+  short itemSize, position, copySize;
+  itemSize = IsosSpscBuffer_getDataSize(spscBuffer, ISOS_SPSC_LOAD_ACQUIRE(spscBuffer->PutIndex), getIndex);
+  if (minItemSize > 0){ //positive expected minimum item size
+    if (itemSize < minItemSize) //positive minItemSize but the data size is smaller than that
+      return 0; //unsuccessful
+    itemSize = minItemSize;
+  }
+  if (itemSize <= 0) //nothing to return
+    return 0;
+  position = (short)IsosSpscBuffer_toPosition(spscBuffer, getIndex);
+  copySize = spscBuffer->BufferSize - position < itemSize ? spscBuffer->BufferSize - position : itemSize;
+  memcpy(items, &spscBuffer->Buffer[position], copySize); //copy from segment from this current index to the last index
+  if (copySize < itemSize)
+    memcpy(&items[copySize], spscBuffer->Buffer, itemSize - copySize); //copy from segment from 0-index to the current index-1
+  return itemSize; //returns the itemSize
+}
+
+short IsosSpscBuffer_Gets(IsosSpscBuffer* spscBuffer, unsigned char* items, short minItemSize){
+  int getIndex = ISOS_SPSC_LOAD_RELAXED(spscBuffer->GetIndex);
+  short itemSize;
+  itemSize = IsosSpscBuffer_Peeks(spscBuffer, items, minItemSize);
+  if (!itemSize) //if no item size is detected, then immediately returns
+    return 0;
+  ISOS_SPSC_STORE_RELEASE(spscBuffer->GetIndex, IsosSpscBuffer_advanceIndex(spscBuffer, getIndex, itemSize));
+  return itemSize; //returns the itemSize
+}
+
+char IsosSpscBuffer_HasExpectedDataSize(IsosSpscBuffer* spscBuffer){
+  if (spscBuffer->ExpectedDataSize < 0) //negative value means expecting any positive data size
+    return IsosSpscBuffer_GetDataSize(spscBuffer) > 0;
+  if (spscBuffer->ExpectedDataSize == 0) //zero value means does not expect any data size from this buffer
+    return 1; //always return true
+  return IsosSpscBuffer_GetDataSize(spscBuffer) >= spscBuffer->ExpectedDataSize;
+}
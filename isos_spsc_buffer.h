@@ -0,0 +1,82 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_spsc_buffer.c, isos_spsc_buffer.h
+  - Describe the single-producer/single-consumer (SPSC) variant of the IsosBuffer, used when the producer and the consumer
+    run concurrently (i.e. an ISR or a reader thread on one side and a task on the other side)
+  - The producer only writes the put index and the consumer only writes the get index, there is no shared data size,
+    so every function is wait-free without any lock
+  - Like the IsosBuffer, the buffer is circular
+*/
+
+#ifndef ISOS_SPSC_BUFFER_H
+#define ISOS_SPSC_BUFFER_H
+
+//The indices are published with release stores and read with acquire loads, so that the data is visible before the index
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+typedef atomic_int IsosSpscIndex;
+#define ISOS_SPSC_LOAD_RELAXED(index) atomic_load_explicit(&(index), memory_order_relaxed)
+#define ISOS_SPSC_LOAD_ACQUIRE(index) atomic_load_explicit(&(index), memory_order_acquire)
+#define ISOS_SPSC_STORE_RELEASE(index, value) atomic_store_explicit(&(index), (value), memory_order_release)
+#elif defined(__GNUC__)
+typedef int IsosSpscIndex;
+#define ISOS_SPSC_LOAD_RELAXED(index) __atomic_load_n(&(index), __ATOMIC_RELAXED)
+#define ISOS_SPSC_LOAD_ACQUIRE(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define ISOS_SPSC_STORE_RELEASE(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+#else
+typedef volatile int IsosSpscIndex; //no atomics, only for single-core targets where an int store cannot be seen half-done by the ISR
+#define ISOS_SPSC_LOAD_RELAXED(index) (index)
+#define ISOS_SPSC_LOAD_ACQUIRE(index) (index)
+#define ISOS_SPSC_STORE_RELEASE(index, value) ((index) = (value))
+#endif
+
+//The indices run from 0 to 2 * BufferSize - 1, so that a full buffer (BufferSize apart) and an empty buffer (same index) differ
+typedef struct IsosSpscBufferStruct {
+  unsigned char* Buffer; //pointer to buffer
+  short BufferSize; //the size of the buffer
+  IsosSpscIndex PutIndex; //current put index of the buffer, only written by the producer
+  IsosSpscIndex GetIndex; //current get index of the buffer, only written by the consumer
+  short ExpectedDataSize; //see IsosBuffer.ExpectedDataSize
+} IsosSpscBuffer;
+
+void IsosSpscBuffer_Init(IsosSpscBuffer* spscBuffer, unsigned char* buffer, short bufferSize); //before the producer and the consumer start
+short IsosSpscBuffer_GetDataSize(IsosSpscBuffer* spscBuffer); //can only grow for the consumer, and only shrink for the producer
+//Producer functions
+char IsosSpscBuffer_Put(IsosSpscBuffer* spscBuffer, unsigned char item); //to put data to the buffer, if unsuccessful, returns 0
+char IsosSpscBuffer_Puts(IsosSpscBuffer* spscBuffer, unsigned char* items, short itemSize); //all or nothing, if unsuccessful, returns 0
+//Consumer functions
+void IsosSpscBuffer_Flush(IsosSpscBuffer* spscBuffer); //to clear the data put so far
+char IsosSpscBuffer_Peek(IsosSpscBuffer* spscBuffer, unsigned char* item);
+char IsosSpscBuffer_Get(IsosSpscBuffer* spscBuffer, unsigned char* item);
+short IsosSpscBuffer_Peeks(IsosSpscBuffer* spscBuffer, unsigned char* items, short minItemSize); //see IsosBuffer_Peeks
+short IsosSpscBuffer_Gets(IsosSpscBuffer* spscBuffer, unsigned char* items, short minItemSize); //see IsosBuffer_Gets
+char IsosSpscBuffer_HasExpectedDataSize(IsosSpscBuffer* spscBuffer); //see IsosBuffer_HasExpectedDataSize
+
+#endif // ISOS_SPSC_BUFFER_H
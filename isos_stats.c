@@ -0,0 +1,79 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_stats.c, isos_stats.h
+  - Describe the (optional) per-task statistics of ISOS, used to see which tasks miss their cadence under load
+  - Each statistic is a fixed-bucket histogram, so adding a sample costs a few shifts and no memory
+  - Compiled out completely unless ISOS_TASK_STATS is set to 1
+*/
+
+#include <string.h>
+#include "isos_stats.h"
+
+void IsosHistogram_Reset(IsosHistogram* histogram){
+  memset(histogram, 0, sizeof(IsosHistogram));
+}
+
+void IsosHistogram_Add(IsosHistogram* histogram, long long sample){
+  short bucketNo = 0;
+  long long value;
+  if (sample < 0)
+    sample = 0;
+  for (value = sample; value > 0 && bucketNo < STATS_BUCKET_SIZE - 1; value >>= 1) //the bucket is the number of the significant bits
+    bucketNo++;
+  histogram->Counts[bucketNo]++;
+  histogram->SampleSize++;
+  histogram->Total += sample;
+  if (sample > histogram->Max)
+    histogram->Max = sample;
+}
+
+long long IsosHistogram_GetBucketLimit(short bucketNo){
+  if (bucketNo < 0 || bucketNo >= STATS_BUCKET_SIZE - 1)
+    return -1;
+  return (1LL << bucketNo) - 1;
+}
+
+long long IsosHistogram_GetPercentile(const IsosHistogram* histogram, unsigned char percent){
+  unsigned long long count = 0, target;
+  short bucketNo;
+  if (histogram->SampleSize == 0)
+    return 0;
+  target = ((unsigned long long)histogram->SampleSize * (percent > 100 ? 100 : percent) + 99) / 100; //rounded up, so that 100 gives the last sample
+  for (bucketNo = 0; bucketNo < STATS_BUCKET_SIZE - 1; ++bucketNo){
+    count += histogram->Counts[bucketNo];
+    if (count >= target) //the bucket limit, unless the largest sample is smaller
+      return IsosHistogram_GetBucketLimit(bucketNo) < histogram->Max ? IsosHistogram_GetBucketLimit(bucketNo) : histogram->Max;
+  }
+  return histogram->Max; //the last bucket has no limit, but it cannot be more than the largest sample
+}
+
+void IsosTaskStats_Reset(IsosTaskStats* stats){
+  memset(stats, 0, sizeof(IsosTaskStats));
+}
@@ -0,0 +1,67 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_stats.c, isos_stats.h
+  - Describe the (optional) per-task statistics of ISOS, used to see which tasks miss their cadence under load
+  - Each statistic is a fixed-bucket histogram, so adding a sample costs a few shifts and no memory
+  - Compiled out completely unless ISOS_TASK_STATS is set to 1
+*/
+
+#ifndef ISOS_STATS_H
+#define ISOS_STATS_H
+
+#ifndef ISOS_TASK_STATS
+#define ISOS_TASK_STATS 0 //set to 1 to let the OS keep the histograms of every task (costs sizeof(IsosTaskStats) of the arena per task)
+#endif // ISOS_TASK_STATS
+
+#define STATS_BUCKET_SIZE 16 //bucket 0 holds 0, bucket n holds 2^(n-1) to 2^n - 1, the last bucket also holds everything above
+
+typedef struct IsosHistogramStruct {
+  unsigned long Counts[STATS_BUCKET_SIZE]; //the number of the samples in each bucket
+  unsigned long SampleSize;
+  long long Total; //the sum of all samples, to get the average
+  long long Max; //the largest sample
+} IsosHistogram;
+
+typedef struct IsosTaskStatsStruct {
+  IsosHistogram DispatchLatencyMs; //from the time the task is due (LastDueReported) to the time it is executed (LastExecuted)
+  IsosHistogram RunSpanMs; //from the time the task is executed (LastExecuted) to the time it is finished (LastFinished)
+  IsosHistogram PeriodJitterMs; //how far the time between two executions is from the period, Repeated and Periodic tasks only
+  IsosHistogram InvocationsPerCompletion; //the number of the task action calls needed to finish the task once
+  unsigned short InvocationSize; //the number of the task action calls since the task is last executed
+  char HasExecuted; //the jitter can only be known from the second execution onwards
+} IsosTaskStats;
+
+void IsosHistogram_Reset(IsosHistogram* histogram);
+void IsosHistogram_Add(IsosHistogram* histogram, long long sample); //negative sample is counted as 0
+long long IsosHistogram_GetBucketLimit(short bucketNo); //the largest sample held by the bucket, -1 for the last bucket (no limit)
+long long IsosHistogram_GetPercentile(const IsosHistogram* histogram, unsigned char percent); //the limit of the bucket reaching the percentile
+void IsosTaskStats_Reset(IsosTaskStats* stats);
+
+#endif // ISOS_STATS_H
@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -30,7 +30,7 @@
   isos_task.c, isos_task.h
   - Describe the task information structures and functions used in ISOS
   - Describe different task-state and task-types used in ISOS
-  - isos_task.h is the only file used to configure ISOS settings (with only six (6) macros to set)
+  - isos_task.h is the only file used to configure ISOS settings (with only a handful of macros to set)
 */
 
 #include <stdio.h>
@@ -49,18 +49,18 @@ IsosClock IsosTask_getCycleTaskNextDue(const IsosTaskInfo *taskInfo){
   }
 }
 
-IsosClock IsosTask_getCycleTaskDiffToNextDue(const IsosClock* mainClock, const IsosTaskInfo *taskInfo){
-  IsosClock clock = IsosTask_getCycleTaskNextDue(taskInfo);
-  return IsosClock_Minus(mainClock, &clock);
+//Function to get the absolute time on which a task is to be due, regardless of its type
+IsosClock IsosTask_GetNextDue(const IsosTaskInfo *taskInfo){
+  if (taskInfo->Type == IsosTaskType_NonCyclical || taskInfo->Type == IsosTaskType_Resource)
+    return taskInfo->TimeInfo.ExecutionDue; //if run once or resource task, the execution due is already absolute
+  return IsosTask_getCycleTaskNextDue(taskInfo);
 }
 
 //Function to check if a task is due, task which is already due should be checked here in the first place
 char IsosTask_IsDue(const IsosClock* mainClock, const IsosTaskInfo *taskInfo){
-  IsosClock clock; //if run once or resource task, check if it is due compared to the main clock, periodic or repeated, then just
-  clock = taskInfo->Type == IsosTaskType_NonCyclical || taskInfo->Type == IsosTaskType_Resource ?
-    IsosClock_Minus(mainClock, &taskInfo->TimeInfo.ExecutionDue) :
-    IsosTask_getCycleTaskDiffToNextDue(mainClock, taskInfo);
-  return IsosClock_GetDirection(&clock) >= 0;
+  IsosClock clock;
+  clock = IsosTask_GetNextDue(taskInfo);
+  return IsosClock_Compare(mainClock, &clock) >= 0;
 }
 
 void IsosTask_ClearActionFlags(IsosTaskActionInfo* taskActionInfo){
@@ -77,9 +77,8 @@ void IsosTask_ResetState(IsosTaskInfo *taskInfo){
 
 char IsosTask_IsTimeout(const IsosClock* mainClock, const IsosTaskInfo *taskInfo){
   IsosClock clock;
-  if (!taskInfo->Timeout.Day && !taskInfo->Timeout.Ms)
+  if (IsosClock_IsZero(&taskInfo->Timeout))
     return 0; //uninitialized timeout values means there is no timeout for this task
-  clock = IsosClock_Minus(mainClock, &taskInfo->LastExecuted);
-  clock = IsosClock_Minus(&taskInfo->Timeout, &clock);
-  return IsosClock_GetDirection(&clock) <= 0; //means the elapsed time since last executed is greater than the allowed time for timeout
+  clock = IsosClock_Add(&taskInfo->LastExecuted, &taskInfo->Timeout); //the time on which the task is timeout
+  return IsosClock_Compare(mainClock, &clock) >= 0; //means the elapsed time since last executed is greater than the allowed time for timeout
 }
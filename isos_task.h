@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -30,7 +30,7 @@
   isos_task.c, isos_task.h
   - Describe the task information structures and functions used in ISOS
   - Describe different task-state and task-types used in ISOS
-  - isos_task.h is the only file used to configure ISOS settings (with only six (6) macros to set)
+  - isos_task.h is the only file used to configure ISOS settings (with only a handful of macros to set)
 */
 
 #ifndef ISOS_TASK_H
@@ -46,11 +46,13 @@
 
 //Configure only the macros below
 #define TASK_FLAGS_SIZE 4
-#define MAX_TASK_SIZE 48 //assume maximum of 48 tasks for now, put this between 2 to 127 (can actually be more, but not tested yet...)
+#define MAX_TASK_SIZE 48 //the task capacity of Isos_Init, put this between 2 to 32,767. Isos_InitWithArena decides the capacity at runtime instead
+#define MAX_RESOURCE_SIZE 8 //the resource capacity of Isos_Init (the resource types 0 to MAX_RESOURCE_SIZE - 1), put this between 0 to 32,767
+#define MAX_EVENT_GROUP_SIZE 8 //the event group capacity of Isos_Init, put this between 0 to 32,767
+#define MAX_MAILBOX_SIZE 8 //the mailbox capacity of Isos_Init, put this between 0 to 32,767
 #define MAX_PRIORITY 100 //like immediately needs to be run
 #define CLOCK_PERIOD_DAY 0 //0-32,767 depending on the clock speed, this may be adjusted
 #define CLOCK_PERIOD_MS 10 //0-86,399,999 depending on the clock speed, this may be adjusted
-#define RESOURCE_SIZE 8 //should be identical number with IsosResourceTaskType
 
 typedef enum IsosTaskTypeEnum {
   //Non-cyclical
@@ -79,7 +81,6 @@ typedef struct IsosTaskActionInfoStruct {
   char Enabled; //flag to specify if a task is enabled or not - so that the task action can disabled its own task if necessary
   unsigned char Subtask; //just a number indicating its current subtask - so that the task action can change its own subtask
   unsigned char Flags[TASK_FLAGS_SIZE]; //just simple, additional semaphore flags to indicate task result, if there is any - so that the task action can share its results
-  //for resource task, Flags = Next Claimer Flag | Next Claimer Id | Next Claimer Priority | Reserved
 } IsosTaskActionInfo;
 
 //The two clock items "Period" and "ExecutionDue" will always be mutually exclusive in use, therefore they are a union
@@ -97,7 +98,7 @@ typedef union IsosTaskSuspensionInfoUnion {
 
 typedef struct IsosTaskInfoStruct {
   //Declaring the task Id outside is useless, since it will be determined by the ISOS on registration...
-  unsigned char Id; //The Id of the task, to be used for arrangement, basically the same as index of the task in the register
+  short Id; //The Id of the task, to be used for arrangement, basically the same as index of the task in the register
   unsigned char Priority; //the higher the more priority
   IsosTaskActionInfo ActionInfo; //the action info of the task
   IsosTaskType Type; //The type of the task
@@ -108,9 +109,13 @@ typedef struct IsosTaskInfoStruct {
   IsosTaskSuspensionInfo SuspensionInfo; //The suspension info time for this task, the time can immediately be changed to due after use
   char IsDueReported; //flag to indicate if the due has been reported
   char ForcedDue; //special flag to forcefully run the task immediately
-  IsosClock Timeout; //special clock to indicate the timeout period of a task. Set Timeout.Day = 0 and Timeout.Ms = 0 to give no timeout to a task
+  char ParallelSafe; //flag to allow the task action to run on another thread, together with the other parallel-safe tasks (see IsosExecutor)
+  char IsBlocked; //flag to keep the suspended task out of the scheduler until the OS wakes it up (i.e. when the resource task it waits for completes)
+  short ResourceType; //the resource type of a resource task given on its registration, -1 for the other task types
+  IsosClock Timeout; //special clock to indicate the timeout period of a task. Set Timeout = IsosClock_Create(0, 0) to give no timeout to a task
 } IsosTaskInfo;
 
+IsosClock IsosTask_GetNextDue(const IsosTaskInfo *taskInfo);
 char IsosTask_IsDue(const IsosClock* mainClock, const IsosTaskInfo *taskInfo);
 void IsosTask_ClearActionFlags(IsosTaskActionInfo* taskActionInfo);
 void IsosTask_ResetState(IsosTaskInfo *taskInfo);
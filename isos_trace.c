@@ -0,0 +1,92 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_trace.c, isos_trace.h
+  - Describe the (optional) binary trace of the scheduling decisions of ISOS, used to reproduce the exact interleaving of a run
+  - Every event is a fixed-size record (due, dispatch, state, claim/release, suspend/wake, timeout, scheduler run, external stimulus)
+    written into memory given by the caller (i.e. a memory-mapped file, see isos_trace_linux), recording costs a few stores per event
+  - The same trace can be replayed: the events happening now are compared with the recorded ones, the first difference is kept
+  - Compiled out completely from the OS unless ISOS_TRACE is set to 1
+*/
+
+#include "isos_trace.h"
+
+void IsosTrace_InitRecord(IsosTrace* trace, IsosTraceEvent* events, long capacity){
+  trace->Events = events;
+  trace->Capacity = capacity;
+  trace->Size = 0;
+  trace->Overflowed = 0;
+  trace->ExpectedEvents = (void*)0;
+  trace->ExpectedSize = 0;
+  trace->MismatchIndex = -1;
+}
+
+void IsosTrace_InitReplay(IsosTrace* trace, const IsosTraceEvent* expectedEvents, long expectedSize){
+  IsosTrace_InitRecord(trace, (void*)0, 0);
+  trace->ExpectedEvents = expectedEvents;
+  trace->ExpectedSize = expectedSize;
+}
+
+char IsosTrace_isSameEvent(const IsosTraceEvent* event, const IsosTraceEvent* otherEvent){
+  return event->ClockMs == otherEvent->ClockMs && event->Value == otherEvent->Value && event->TaskId == otherEvent->TaskId &&
+         event->Type == otherEvent->Type && event->Detail == otherEvent->Detail;
+}
+
+void IsosTrace_Record(IsosTrace* trace, long long clockMs, IsosTraceEventType type, short taskId, unsigned char detail, int value){
+  IsosTraceEvent event;
+  event.ClockMs = clockMs;
+  event.Value = value;
+  event.TaskId = taskId;
+  event.Type = (unsigned char)type;
+  event.Detail = detail;
+  if (trace->ExpectedEvents){ //replaying, only the first difference matters
+    if (trace->MismatchIndex < 0 && (trace->Size >= trace->ExpectedSize || !IsosTrace_isSameEvent(&event, &trace->ExpectedEvents[trace->Size])))
+      trace->MismatchIndex = trace->Size;
+    trace->Size++;
+    return;
+  }
+  if (trace->Size >= trace->Capacity){
+    trace->Overflowed = 1;
+    return;
+  }
+  trace->Events[trace->Size] = event;
+  trace->Size++;
+}
+
+const IsosTraceEvent* IsosTrace_GetExpected(const IsosTrace* trace){
+  if (!trace->ExpectedEvents || trace->Size >= trace->ExpectedSize)
+    return (void*)0;
+  return &trace->ExpectedEvents[trace->Size];
+}
+
+long IsosTrace_GetEventSize(const IsosTraceEvent* events, long capacity){
+  long size;
+  for (size = 0; size < capacity && events[size].Type != IsosTraceEventType_None; ++size);
+  return size;
+}
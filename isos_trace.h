@@ -0,0 +1,97 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_trace.c, isos_trace.h
+  - Describe the (optional) binary trace of the scheduling decisions of ISOS, used to reproduce the exact interleaving of a run
+  - Every event is a fixed-size record (due, dispatch, state, claim/release, suspend/wake, timeout, scheduler run, external stimulus)
+    written into memory given by the caller (i.e. a memory-mapped file, see isos_trace_linux), recording costs a few stores per event
+  - The same trace can be replayed: the events happening now are compared with the recorded ones, the first difference is kept
+  - Compiled out completely from the OS unless ISOS_TRACE is set to 1
+*/
+
+#ifndef ISOS_TRACE_H
+#define ISOS_TRACE_H
+
+#ifndef ISOS_TRACE
+#define ISOS_TRACE 0 //set to 1 to let the OS record its scheduling decisions into the attached trace (costs a null check per event when none is attached)
+#endif // ISOS_TRACE
+
+//The types start from 1, so that a zeroed event marks the end of the recorded events (i.e. in a trace file which has not been closed)
+typedef enum IsosTraceEventTypeEnum {
+  IsosTraceEventType_None = 0,
+  IsosTraceEventType_SchedulerRun, //the scheduler is run (an input of the replay)
+  IsosTraceEventType_Stimulus, //Detail: the kind, Value: the value of an external stimulus (an input of the replay)
+  IsosTraceEventType_Due, //the task is queued on due, Detail: its priority
+  IsosTraceEventType_Dispatch, //the task is about to be run, Detail: its subtask, Value: its state
+  IsosTraceEventType_State, //the task has been run, Detail: its subtask, Value: its state
+  IsosTraceEventType_Claim, //TaskId: the claimer, Detail: the resource type, Value: 1 if claimed, 0 if not, -1 if a more important waiter is on due
+  IsosTraceEventType_Release, //TaskId: the resource task, Detail: the resource type, Value: the waiter it is handed over to, -1 if none
+  IsosTraceEventType_Suspend, //Value: the suspension due (ms), -1 if blocked until woken up
+  IsosTraceEventType_Wake, //Detail: 1 if the suspension is over, 0 if woken up from the blocking
+  IsosTraceEventType_Timeout, //the task is timed out by the OS
+  //The events below are only put into the trace ring (see isos_trace_ring), they are not scheduling decisions
+  IsosTraceEventType_Buffer, //TaskId: the resource task, Detail: the IsosTraceBufferAccess, Value: the data size in the buffer
+  IsosTraceEventType_ResourceCheck, //TaskId: the resource task, Detail: the resource type, Value: its state
+  IsosTraceEventType_ResourceInvalid //Value: the resource type which is not registered
+} IsosTraceEventType;
+
+typedef enum IsosTraceBufferAccessEnum {
+  IsosTraceBufferAccess_Get = 0, //Rx, before the data is taken
+  IsosTraceBufferAccess_Peek, //Rx
+  IsosTraceBufferAccess_Put, //Tx, after the data is put (or committed)
+  IsosTraceBufferAccess_TxDataSize,
+  IsosTraceBufferAccess_RxDataSize
+} IsosTraceBufferAccess;
+
+typedef struct IsosTraceEventStruct { //16 bytes, written and read back as is
+  long long ClockMs; //the main clock when the event happens
+  int Value;
+  short TaskId; //-1 if the event is not about a task
+  unsigned char Type; //IsosTraceEventType
+  unsigned char Detail;
+} IsosTraceEvent;
+
+//The IsosTrace does not own its memory, the events are given on initialization
+typedef struct IsosTraceStruct {
+  IsosTraceEvent* Events; //where the events are recorded, null when replaying
+  long Capacity;
+  long Size; //the number of events recorded (or compared) so far
+  char Overflowed; //the trace is full, the events after it are dropped
+  const IsosTraceEvent* ExpectedEvents; //the recorded events to compare with, null when recording
+  long ExpectedSize;
+  long MismatchIndex; //the first event which is not the same as the recorded one, -1 if there is none
+} IsosTrace;
+
+void IsosTrace_InitRecord(IsosTrace* trace, IsosTraceEvent* events, long capacity);
+void IsosTrace_InitReplay(IsosTrace* trace, const IsosTraceEvent* expectedEvents, long expectedSize);
+void IsosTrace_Record(IsosTrace* trace, long long clockMs, IsosTraceEventType type, short taskId, unsigned char detail, int value);
+const IsosTraceEvent* IsosTrace_GetExpected(const IsosTrace* trace); //when replaying, the next recorded event, null if there is none anymore
+long IsosTrace_GetEventSize(const IsosTraceEvent* events, long capacity); //the number of events before the first zeroed one
+
+#endif // ISOS_TRACE_H
@@ -0,0 +1,121 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_trace_linux.c, isos_trace_linux.h
+  - Provide the trace file of ISOS for Linux (i.e. to record a flight software run on a ground host, then to replay it)
+  - The file is memory-mapped, so the events are recorded with plain stores, the kernel never waits for a write
+  - The file starts with a small header, then the fixed-size events as they are in memory (same host, same layout)
+  - A file which has not been closed (i.e. the program has crashed) can still be replayed, up to the last event recorded
+*/
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "isos_trace_linux.h"
+
+char IsosTraceLinux_map(IsosTraceLinux* file, int protection){
+  file->Map = mmap((void*)0, (size_t)file->MapSize, protection, MAP_SHARED, file->Fd, 0);
+  if (file->Map != MAP_FAILED)
+    return 1;
+  close(file->Fd);
+  file->Map = (void*)0;
+  return 0;
+}
+
+char IsosTraceLinux_OpenRecord(IsosTraceLinux* file, const char* path, long capacity){
+  IsosTraceLinuxHeader* header;
+  if (capacity <= 0 || (file->Fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0)
+    return 0;
+  file->MapSize = (long long)sizeof(IsosTraceLinuxHeader) + (long long)capacity * sizeof(IsosTraceEvent);
+  if (ftruncate(file->Fd, (off_t)file->MapSize) != 0){ //the file is sparse, zeroed until the events are recorded
+    close(file->Fd);
+    return 0;
+  }
+  if (!IsosTraceLinux_map(file, PROT_READ | PROT_WRITE))
+    return 0;
+  header = file->Map;
+  header->Magic = TRACE_LINUX_MAGIC;
+  header->Version = TRACE_LINUX_VERSION;
+  header->EventSize = sizeof(IsosTraceEvent);
+  header->Capacity = capacity;
+  header->Size = 0;
+  IsosTrace_InitRecord(&file->Trace, (IsosTraceEvent*)(header + 1), capacity);
+  file->IsRecording = 1;
+  return 1;
+}
+
+char IsosTraceLinux_OpenReplay(IsosTraceLinux* file, const char* path){
+  IsosTraceLinuxHeader* header;
+  struct stat status;
+  long long capacity;
+  if ((file->Fd = open(path, O_RDONLY)) < 0)
+    return 0;
+  if (fstat(file->Fd, &status) != 0 || status.st_size < (off_t)sizeof(IsosTraceLinuxHeader)){
+    close(file->Fd);
+    return 0;
+  }
+  file->MapSize = status.st_size;
+  if (!IsosTraceLinux_map(file, PROT_READ))
+    return 0;
+  header = file->Map;
+  file->IsRecording = 0;
+  if (header->Magic != TRACE_LINUX_MAGIC || header->Version != TRACE_LINUX_VERSION || header->EventSize != sizeof(IsosTraceEvent)){
+    IsosTraceLinux_Close(file);
+    return 0;
+  }
+  capacity = (file->MapSize - (long long)sizeof(IsosTraceLinuxHeader)) / (long long)sizeof(IsosTraceEvent);
+  if (header->Size > 0 && header->Size < capacity)
+    capacity = header->Size;
+  else //not closed, the recorded events are followed by the zeroed ones
+    capacity = IsosTrace_GetEventSize((const IsosTraceEvent*)(header + 1), (long)capacity);
+  IsosTrace_InitReplay(&file->Trace, (const IsosTraceEvent*)(header + 1), (long)capacity);
+  return 1;
+}
+
+char IsosTraceLinux_Close(IsosTraceLinux* file){
+  long long size;
+  char result = 1;
+  if (!file->Map)
+    return 0;
+  if (file->IsRecording){
+    size = file->Trace.Size; //never more than the capacity, the overflowed events are dropped
+    ((IsosTraceLinuxHeader*)file->Map)->Size = size;
+    munmap(file->Map, (size_t)file->MapSize);
+    result = ftruncate(file->Fd, (off_t)((long long)sizeof(IsosTraceLinuxHeader) + size * (long long)sizeof(IsosTraceEvent))) == 0;
+  } else
+    munmap(file->Map, (size_t)file->MapSize);
+  close(file->Fd);
+  file->Map = (void*)0;
+  return result;
+}
+
+#endif // __linux__
@@ -0,0 +1,67 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_trace_linux.c, isos_trace_linux.h
+  - Provide the trace file of ISOS for Linux (i.e. to record a flight software run on a ground host, then to replay it)
+  - The file is memory-mapped, so the events are recorded with plain stores, the kernel never waits for a write
+  - The file starts with a small header, then the fixed-size events as they are in memory (same host, same layout)
+  - A file which has not been closed (i.e. the program has crashed) can still be replayed, up to the last event recorded
+*/
+
+#ifndef ISOS_TRACE_LINUX_H
+#define ISOS_TRACE_LINUX_H
+
+#define TRACE_LINUX_MAGIC 0x52545349 //"ISTR"
+#define TRACE_LINUX_VERSION 1
+
+#if defined(__linux__)
+#include "isos_trace.h"
+
+typedef struct IsosTraceLinuxHeaderStruct {
+  unsigned int Magic;
+  unsigned short Version;
+  unsigned short EventSize; //sizeof(IsosTraceEvent) of the recording host
+  long long Capacity; //the number of events the file can hold
+  long long Size; //the number of events recorded, only written on close (0 if the file has not been closed)
+} IsosTraceLinuxHeader;
+
+typedef struct IsosTraceLinuxStruct {
+  IsosTrace Trace; //to be attached to the kernel (see IsosKernel_SetTrace, IsosKernel_Replay)
+  int Fd;
+  void* Map; //the header, followed by the events
+  long long MapSize;
+  char IsRecording;
+} IsosTraceLinux;
+
+char IsosTraceLinux_OpenRecord(IsosTraceLinux* file, const char* path, long capacity); //creates (or truncates) the file, returns 0 if failed
+char IsosTraceLinux_OpenReplay(IsosTraceLinux* file, const char* path); //returns 0 if the file cannot be read or is not a trace file of this host
+char IsosTraceLinux_Close(IsosTraceLinux* file); //when recording, the file is cut to the recorded events, returns 0 if it cannot be cut (the zeroed tail is skipped anyway)
+#endif // __linux__
+
+#endif // ISOS_TRACE_LINUX_H
@@ -0,0 +1,230 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+  isos_trace_ring.c, isos_trace_ring.h
+  - Describe the (optional) trace ring of ISOS, the low-overhead replacement of the printing done by isos_debug_basic
+  - The kernel puts fixed-size binary events (the IsosTraceEvent, stamped with the monotonic time) into a lock-free ring,
+    putting an event costs a compare-and-swap and a few stores, the event is dropped (and counted) when the ring is full
+  - The events are only formatted later, out of the scheduling path: either by draining the ring in an idle hook
+    (i.e. see IsosHostLinux_SetIdleAction), or by writing them to a file which is decoded offline (see isos_trace_decode)
+  - Each event category can be left out at compile time (ISOS_TRACE_RING_CATEGORIES), the events of the left out categories cost nothing
+  - Compiled out completely from the OS unless ISOS_TRACE_RING is set to 1
+*/
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif // defined
+#include <time.h>
+#include "isos_clock.h"
+#include "isos_trace_ring.h"
+
+void IsosTraceRing_Init(IsosTraceRing* ring, IsosTraceRingSlot* slots, unsigned long slotSize){
+  unsigned long i;
+  ring->Slots = slots;
+  ring->Capacity = 1;
+  while (ring->Capacity * 2 <= slotSize) //the slot of a put number is found with a mask
+    ring->Capacity *= 2;
+  for (i = 0; i < ring->Capacity; ++i)
+    ISOS_TRACE_RING_INIT(slots[i].Sequence, i);
+  ISOS_TRACE_RING_INIT(ring->PutNo, 0);
+  ring->GetNo = 0;
+  ISOS_TRACE_RING_INIT(ring->DroppedSize, 0);
+}
+
+long long IsosTraceRing_GetNs(){
+  struct timespec now;
+  #if defined(__linux__)
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  #else
+  timespec_get(&now, TIME_UTC); //C11, used where there is no monotonic clock
+  #endif // defined
+  return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+void IsosTraceRing_Put(IsosTraceRing* ring, long long clockMs, IsosTraceEventType type, short taskId, unsigned char detail, int value){
+  IsosTraceRingSlot* slot;
+  long difference;
+  unsigned long putNo = ISOS_TRACE_RING_LOAD_RELAXED(ring->PutNo);
+  while (1){
+    slot = &ring->Slots[putNo & (ring->Capacity - 1)];
+    difference = (long)(ISOS_TRACE_RING_LOAD_ACQUIRE(slot->Sequence) - putNo);
+    if (difference == 0){ //the slot is free for this put number
+      if (ISOS_TRACE_RING_CLAIM(ring->PutNo, putNo)) //if another producer is faster, putNo is reloaded
+        break;
+    } else if (difference < 0){ //the slot still holds the event put one ring earlier, the ring is full
+      ISOS_TRACE_RING_COUNT(ring->DroppedSize);
+      return;
+    } else //another producer has already claimed this put number
+      putNo = ISOS_TRACE_RING_LOAD_RELAXED(ring->PutNo);
+  }
+  slot->Event.TimeNs = ISOS_TRACE_RING_GET_NS();
+  slot->Event.Event.ClockMs = clockMs;
+  slot->Event.Event.Value = value;
+  slot->Event.Event.TaskId = taskId;
+  slot->Event.Event.Type = (unsigned char)type;
+  slot->Event.Event.Detail = detail;
+  ISOS_TRACE_RING_STORE_RELEASE(slot->Sequence, putNo + 1); //the event is visible to the consumer only from now on
+}
+
+char IsosTraceRing_Get(IsosTraceRing* ring, IsosTraceRingEvent* event){
+  IsosTraceRingSlot* slot = &ring->Slots[ring->GetNo & (ring->Capacity - 1)];
+  if (ISOS_TRACE_RING_LOAD_ACQUIRE(slot->Sequence) != ring->GetNo + 1)
+    return 0;
+  *event = slot->Event;
+  ISOS_TRACE_RING_STORE_RELEASE(slot->Sequence, ring->GetNo + ring->Capacity); //the slot is free for the put number one ring later
+  ring->GetNo++;
+  return 1;
+}
+
+//Stops after one ring full, so that the producers which keep putting events cannot hold the consumer forever
+long IsosTraceRing_Drain(IsosTraceRing* ring, void (*eventAction)(const IsosTraceRingEvent*, void*), void* argument){
+  IsosTraceRingEvent event;
+  long drainedSize = 0;
+  while (drainedSize < (long)ring->Capacity && IsosTraceRing_Get(ring, &event)){
+    eventAction(&event, argument);
+    drainedSize++;
+  }
+  return drainedSize;
+}
+
+unsigned long IsosTraceRing_GetDroppedSize(IsosTraceRing* ring){ return ISOS_TRACE_RING_LOAD_RELAXED(ring->DroppedSize); }
+
+const char* IsosTraceRing_EventTypeToString(IsosTraceEventType type){
+  switch(type){
+    case IsosTraceEventType_SchedulerRun: return "SCHEDULER";
+    case IsosTraceEventType_Stimulus: return "STIMULUS";
+    case IsosTraceEventType_Due: return "DUE";
+    case IsosTraceEventType_Dispatch: return "DISPATCH";
+    case IsosTraceEventType_State: return "STATE";
+    case IsosTraceEventType_Claim: return "CLAIM";
+    case IsosTraceEventType_Release: return "RELEASE";
+    case IsosTraceEventType_Suspend: return "SUSPEND";
+    case IsosTraceEventType_Wake: return "WAKE";
+    case IsosTraceEventType_Timeout: return "TIMEOUT";
+    case IsosTraceEventType_Buffer: return "BUFFER";
+    case IsosTraceEventType_ResourceCheck: return "CHECK";
+    case IsosTraceEventType_ResourceInvalid: return "INVALID";
+    case IsosTraceEventType_None:
+    default: return "UNKNOWN";
+  }
+}
+
+const char* IsosTraceRing_bufferAccessToString(IsosTraceBufferAccess access){
+  switch(access){
+    case IsosTraceBufferAccess_Get: return "GET Rx";
+    case IsosTraceBufferAccess_Peek: return "PEEK Rx";
+    case IsosTraceBufferAccess_Put: return "PUT Tx";
+    case IsosTraceBufferAccess_TxDataSize: return "DATASIZE Tx";
+    case IsosTraceBufferAccess_RxDataSize: return "DATASIZE Rx";
+  }
+  return "UNKNOWN";
+}
+
+//Like the printing of isos_debug_basic: the main clock as DDD-MMMMMMMM, the task as two digits, the resource types from 1
+void IsosTraceRing_Format(const IsosTraceRingEvent* event, char* text, int textSize){
+  const IsosTraceEvent* traceEvent = &event->Event;
+  int size = snprintf(text, textSize, "%03d-%08ld [%lld.%09lld] %-9s ", (int)(traceEvent->ClockMs / MS_PER_DAY), (long)(traceEvent->ClockMs % MS_PER_DAY),
+                      event->TimeNs / 1000000000LL, event->TimeNs % 1000000000LL, IsosTraceRing_EventTypeToString(traceEvent->Type));
+  if (size < 0 || size >= textSize)
+    return;
+  text += size;
+  textSize -= size;
+  switch(traceEvent->Type){
+    case IsosTraceEventType_SchedulerRun:
+      text[0] = '\0';
+      break;
+    case IsosTraceEventType_Stimulus:
+      snprintf(text, textSize, "Kind %d, Value %d", traceEvent->Detail, traceEvent->Value);
+      break;
+    case IsosTraceEventType_Due:
+      snprintf(text, textSize, "Task %02d-P%03d", traceEvent->TaskId, traceEvent->Detail);
+      break;
+    case IsosTraceEventType_Dispatch:
+    case IsosTraceEventType_State:
+      snprintf(text, textSize, "Task %02d-S%02d, State %d", traceEvent->TaskId, traceEvent->Detail, traceEvent->Value);
+      break;
+    case IsosTraceEventType_Claim:
+      snprintf(text, textSize, "Task %02d, Resource [Type %d]: %s", traceEvent->TaskId, traceEvent->Detail + 1,
+               traceEvent->Value > 0 ? "Successful" : traceEvent->Value < 0 ? "Failed (has more important waiter)" : "Failed (is still claimed or is running)");
+      break;
+    case IsosTraceEventType_Release:
+      snprintf(text, textSize, "Resource [Type %d] [Task Id: %02d], Handed over to %d", traceEvent->Detail + 1, traceEvent->TaskId, traceEvent->Value);
+      break;
+    case IsosTraceEventType_Suspend:
+      if (traceEvent->Value < 0)
+        snprintf(text, textSize, "Task %02d, until woken up", traceEvent->TaskId);
+      else
+        snprintf(text, textSize, "Task %02d, until %03d-%08d", traceEvent->TaskId, traceEvent->Value / MS_PER_DAY, traceEvent->Value % MS_PER_DAY);
+      break;
+    case IsosTraceEventType_Wake:
+      snprintf(text, textSize, "Task %02d, %s", traceEvent->TaskId, traceEvent->Detail ? "suspension time is over" : "woken up");
+      break;
+    case IsosTraceEventType_Timeout:
+      snprintf(text, textSize, "Task %02d has been running for too long", traceEvent->TaskId);
+      break;
+    case IsosTraceEventType_Buffer:
+      snprintf(text, textSize, "%s [Task Id: %02d], Size %d", IsosTraceRing_bufferAccessToString(traceEvent->Detail), traceEvent->TaskId, traceEvent->Value);
+      break;
+    case IsosTraceEventType_ResourceCheck:
+      snprintf(text, textSize, "Resource [Type %d] [Task Id: %02d], State %d", traceEvent->Detail + 1, traceEvent->TaskId, traceEvent->Value);
+      break;
+    case IsosTraceEventType_ResourceInvalid:
+      snprintf(text, textSize, "Resource [Type %d] is not registered", traceEvent->Value + 1);
+      break;
+    default:
+      snprintf(text, textSize, "Task %d, Detail %d, Value %d", traceEvent->TaskId, traceEvent->Detail, traceEvent->Value);
+      break;
+  }
+}
+
+void IsosTraceRing_PrintEvent(const IsosTraceRingEvent* event, void* file){
+  char text[128];
+  IsosTraceRing_Format(event, text, sizeof(text));
+  fprintf(file, "%s\n", text);
+}
+
+void IsosTraceRing_DrainAndPrint(void* ring){
+  IsosTraceRing_Drain(ring, IsosTraceRing_PrintEvent, stdout);
+}
+
+char IsosTraceRing_WriteFileHeader(FILE* file){
+  IsosTraceRingFileHeader header;
+  header.Magic = TRACE_RING_FILE_MAGIC;
+  header.Version = TRACE_RING_FILE_VERSION;
+  header.EventSize = sizeof(IsosTraceRingEvent);
+  return fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+void IsosTraceRing_WriteEvent(const IsosTraceRingEvent* event, void* file){ fwrite(event, sizeof(IsosTraceRingEvent), 1, file); }
+
+char IsosTraceRing_ReadFileHeader(FILE* file){
+  IsosTraceRingFileHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1)
+    return 0;
+  return header.Magic == TRACE_RING_FILE_MAGIC && header.Version == TRACE_RING_FILE_VERSION && header.EventSize == sizeof(IsosTraceRingEvent);
+}
@@ -0,0 +1,142 @@
+/*Created by Ian K (Mar-2019)
+  Inspire Satellite Operating System (ISOS) is an (1) easy-to-understand, (2) easy-to-use,
+  (3) small-sized, (4) fairly-comprehensive Operating System (OS) software used in Inspire Satellite-4 (IS-4)
+  flight software as a replacement for the earlier non-OS flight software developed fore Inspire Satellite-1 (IS-1).
+  (1) Easy-to-understand:
+      -> Uses simple, straight forward, yet efficient C programming style
+      -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
+      -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
+      -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
+      -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
+  (2) Easy-to-use:
+      -> One line code to initialize
+      -> One line code to register each of the various type of tasks
+      -> One line code to run the OS
+         Note: See note (TODO) in the Isos_Run() function to implement
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
+      -> Demonstrations/examples provided
+  (3) Small-sized
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
+  (4) Fairly-comprehensive
+      -> Sufficient for most of small-to-medium micro-controller OS development project requirements
+      -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
+      -> Capable of handling multiple level of priorities of the tasks
+      -> Capable of managing use of shared resources among the tasks using simple claiming-releasing mechanism
+      -> Capable of segmenting single-function task into various task segments (called subtask)
+      -> Capable of handling task waiting and simple inter-task signals using char[] flags
+
+  isos_trace_ring.c, isos_trace_ring.h
+  - Describe the (optional) trace ring of ISOS, the low-overhead replacement of the printing done by isos_debug_basic
+  - The kernel puts fixed-size binary events (the IsosTraceEvent, stamped with the monotonic time) into a lock-free ring,
+    putting an event costs a compare-and-swap and a few stores, the event is dropped (and counted) when the ring is full
+  - The events are only formatted later, out of the scheduling path: either by draining the ring in an idle hook
+    (i.e. see IsosHostLinux_SetIdleAction), or by writing them to a file which is decoded offline (see isos_trace_decode)
+  - Each event category can be left out at compile time (ISOS_TRACE_RING_CATEGORIES), the events of the left out categories cost nothing
+  - Compiled out completely from the OS unless ISOS_TRACE_RING is set to 1
+*/
+
+#ifndef ISOS_TRACE_RING_H
+#define ISOS_TRACE_RING_H
+
+#include <stdio.h>
+#include "isos_trace.h"
+
+#ifndef ISOS_TRACE_RING
+#define ISOS_TRACE_RING 0 //set to 1 to let the OS put its events into the attached trace ring (costs a null check per event of the enabled categories)
+#endif // ISOS_TRACE_RING
+
+#define ISOS_TRACE_CATEGORY_SCHEDULER 0x01 //the scheduler runs and the external stimuli
+#define ISOS_TRACE_CATEGORY_TASK 0x02 //the due, dispatch and state of the tasks
+#define ISOS_TRACE_CATEGORY_WAIT 0x04 //the suspensions and wake-ups of the tasks
+#define ISOS_TRACE_CATEGORY_RESOURCE 0x08 //the claims, releases and checks of the resource tasks
+#define ISOS_TRACE_CATEGORY_BUFFER 0x10 //the accesses to the resource task buffers
+#define ISOS_TRACE_CATEGORY_TIMEOUT 0x20 //the tasks timed out by the OS
+#define ISOS_TRACE_CATEGORY_ALL 0x3F
+
+#ifndef ISOS_TRACE_RING_CATEGORIES
+#define ISOS_TRACE_RING_CATEGORIES ISOS_TRACE_CATEGORY_ALL //may be set from the build (i.e. to ISOS_TRACE_CATEGORY_WAIT | ISOS_TRACE_CATEGORY_TIMEOUT)
+#endif // ISOS_TRACE_RING_CATEGORIES
+
+#ifndef ISOS_TRACE_RING_GET_NS
+#define ISOS_TRACE_RING_GET_NS() IsosTraceRing_GetNs() //may be set from the build (i.e. to a cycle counter of the target)
+#endif // ISOS_TRACE_RING_GET_NS
+
+#define TRACE_RING_FILE_MAGIC 0x47525349 //"ISRG"
+#define TRACE_RING_FILE_VERSION 1
+
+//The put numbers are claimed with a compare-and-swap, the slots are published with release stores and read with acquire loads
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+typedef atomic_ulong IsosTraceRingNo;
+#define ISOS_TRACE_RING_INIT(no, value) atomic_init(&(no), (value))
+#define ISOS_TRACE_RING_LOAD_RELAXED(no) atomic_load_explicit(&(no), memory_order_relaxed)
+#define ISOS_TRACE_RING_LOAD_ACQUIRE(no) atomic_load_explicit(&(no), memory_order_acquire)
+#define ISOS_TRACE_RING_STORE_RELEASE(no, value) atomic_store_explicit(&(no), (value), memory_order_release)
+#define ISOS_TRACE_RING_CLAIM(no, expected) atomic_compare_exchange_weak_explicit(&(no), &(expected), (expected) + 1, memory_order_relaxed, memory_order_relaxed)
+#define ISOS_TRACE_RING_COUNT(no) atomic_fetch_add_explicit(&(no), 1, memory_order_relaxed)
+#elif defined(__GNUC__)
+typedef unsigned long IsosTraceRingNo;
+#define ISOS_TRACE_RING_INIT(no, value) ((no) = (value))
+#define ISOS_TRACE_RING_LOAD_RELAXED(no) __atomic_load_n(&(no), __ATOMIC_RELAXED)
+#define ISOS_TRACE_RING_LOAD_ACQUIRE(no) __atomic_load_n(&(no), __ATOMIC_ACQUIRE)
+#define ISOS_TRACE_RING_STORE_RELEASE(no, value) __atomic_store_n(&(no), (value), __ATOMIC_RELEASE)
+#define ISOS_TRACE_RING_CLAIM(no, expected) __atomic_compare_exchange_n(&(no), &(expected), (expected) + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#define ISOS_TRACE_RING_COUNT(no) __atomic_fetch_add(&(no), 1, __ATOMIC_RELAXED)
+#else
+typedef volatile unsigned long IsosTraceRingNo; //no atomics, only for single-core targets where no event is put from an ISR
+#define ISOS_TRACE_RING_INIT(no, value) ((no) = (value))
+#define ISOS_TRACE_RING_LOAD_RELAXED(no) (no)
+#define ISOS_TRACE_RING_LOAD_ACQUIRE(no) (no)
+#define ISOS_TRACE_RING_STORE_RELEASE(no, value) ((no) = (value))
+#define ISOS_TRACE_RING_CLAIM(no, expected) ((no) = (expected) + 1, 1)
+#define ISOS_TRACE_RING_COUNT(no) ((no)++)
+#endif
+
+typedef struct IsosTraceRingEventStruct { //24 bytes, written to the trace ring file as is
+  long long TimeNs; //the monotonic time when the event is put, only the differences are meaningful
+  IsosTraceEvent Event; //ClockMs is the main clock of the kernel
+} IsosTraceRingEvent;
+
+//A slot is free for the put number Sequence, once written it holds the event of the put number Sequence - 1
+typedef struct IsosTraceRingSlotStruct {
+  IsosTraceRingNo Sequence;
+  IsosTraceRingEvent Event;
+} IsosTraceRingSlot;
+
+//The IsosTraceRing does not own its memory, the slots are given on initialization
+//Any thread may put the events (i.e. the kernel thread and the executor threads), only one thread may drain them
+typedef struct IsosTraceRingStruct {
+  IsosTraceRingSlot* Slots;
+  unsigned long Capacity; //a power of two
+  IsosTraceRingNo PutNo; //the next put number, claimed by the producers
+  unsigned long GetNo; //the put number of the next event to drain, only used by the consumer
+  IsosTraceRingNo DroppedSize; //the number of events dropped because the ring was full
+} IsosTraceRing;
+
+//The trace ring file starts with the header, then the events as they are in memory (same host, same layout)
+typedef struct IsosTraceRingFileHeaderStruct {
+  unsigned int Magic;
+  unsigned short Version;
+  unsigned short EventSize; //sizeof(IsosTraceRingEvent) of the recording host
+} IsosTraceRingFileHeader;
+
+void IsosTraceRing_Init(IsosTraceRing* ring, IsosTraceRingSlot* slots, unsigned long slotSize); //at least 2 slots, only the largest power of two of them is used
+long long IsosTraceRing_GetNs(); //monotonic time in ns, only the differences are meaningful
+//Producer function
+void IsosTraceRing_Put(IsosTraceRing* ring, long long clockMs, IsosTraceEventType type, short taskId, unsigned char detail, int value); //never waits, drops the event if the ring is full
+//Consumer functions
+char IsosTraceRing_Get(IsosTraceRing* ring, IsosTraceRingEvent* event); //returns 0 if there is no event (or if the oldest one is still being written)
+long IsosTraceRing_Drain(IsosTraceRing* ring, void (*eventAction)(const IsosTraceRingEvent*, void*), void* argument); //at most one ring full, returns the number of events drained
+unsigned long IsosTraceRing_GetDroppedSize(IsosTraceRing* ring);
+//Formatting functions, to be used out of the scheduling path
+const char* IsosTraceRing_EventTypeToString(IsosTraceEventType type);
+void IsosTraceRing_Format(const IsosTraceRingEvent* event, char* text, int textSize);
+void IsosTraceRing_PrintEvent(const IsosTraceRingEvent* event, void* file); //to drain the ring as text, file is a FILE*
+void IsosTraceRing_DrainAndPrint(void* ring); //the events drained as text to stdout, i.e. as the idle action of the host runner
+char IsosTraceRing_WriteFileHeader(FILE* file); //returns 0 if failed
+void IsosTraceRing_WriteEvent(const IsosTraceRingEvent* event, void* file); //to drain the ring into a trace ring file, file is a FILE*
+char IsosTraceRing_ReadFileHeader(FILE* file); //returns 0 if the file is not a trace ring file of this host
+
+#endif // ISOS_TRACE_RING_H
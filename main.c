@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -43,6 +43,16 @@
 #include "main.h"
 #include "isos_debug_basic.h"
 #include "isos_utilities.h"
+#include "isos_host_linux.h"
+#include "isos_simulation.h"
+
+#ifndef TICKLESS_HOST
+#define TICKLESS_HOST 0 //Linux only: set to 1 to run the demonstration in real time with the tickless host runner, instead of ticking per loop
+#endif // TICKLESS_HOST
+#ifndef FAST_FORWARD_SIMULATION
+#define FAST_FORWARD_SIMULATION 0 //set to 1 to run the demonstration on the virtual clock with the fast-forward simulation driver, without any prompt
+#endif // FAST_FORWARD_SIMULATION
+#define SIMULATION_DURATION_MS 20999 //the last clock run by the fast-forward simulation driver
 
 #define RESOURCE_3_RX_BUFFER_SIZE 256
 #define RESOURCE_4_TX_BUFFER_SIZE 128
@@ -66,9 +76,22 @@ int main() {
   Isos_Init(); //the first to be called before registering any task
   registerTasks();
 
+  #if TICKLESS_HOST
+  IsosHostLinux_Init(); //sleeps until the next deadline of the OS instead of busy looping, runs until the program is terminated
+  IsosHostLinux_Run();
+  #endif // TICKLESS_HOST
+
+  #if FAST_FORWARD_SIMULATION
+  IsosSimulation simulation; //jumps the clock over the idle ticks, with the same scheduling decisions as the loop below
+  IsosSimulation_Init(&simulation, IsosKernel_GetDefault());
+  IsosSimulation_RunUntil(&simulation, 0, SIMULATION_DURATION_MS);
+  printf("Simulated %d ms with %lld runs of the OS\n", SIMULATION_DURATION_MS + 1, simulation.RunSize);
+  return 0;
+  #endif // FAST_FORWARD_SIMULATION
+
   while (1){ //While (1) to be used internally in the Isos_Run() function for actual implementation, see TODO note on Isos_Run() function
     mainClock = Isos_GetClock();
-    if (mainClock.Ms > 0 && mainClock.Ms % 1000 == 0){
+    if (IsosClock_GetMs(&mainClock) > 0 && IsosClock_GetMs(&mainClock) % 1000 == 0){
       printf("Press any character key but [x+Enter] to continue...\n");
       scanf(" %c", &val);
       if (val == 'x')
@@ -124,7 +147,7 @@ void simulateCommonTask(IsosTaskActionInfo* taskActionInfo, int endSubtaskNo, Is
     taskActionInfo->Subtask++;
 }
 
-void simulateCommonTaskWithSuspension(unsigned char taskId, IsosTaskActionInfo* taskActionInfo, int endSubtaskNo, IsosTaskState endState,
+void simulateCommonTaskWithSuspension(short taskId, IsosTaskActionInfo* taskActionInfo, int endSubtaskNo, IsosTaskState endState,
                                       int waitingSubtaskNo, short waitingDay, long waitingMs){
   if (taskActionInfo->Subtask == endSubtaskNo)
     taskActionInfo->State = endState;
@@ -145,7 +168,7 @@ void simulateCommonTaskWithErrorRate(IsosTaskActionInfo* taskActionInfo, int end
     taskActionInfo->Subtask++;
 }
 
-void simulateCommonTaskWithResourceUsage(unsigned char taskId, IsosTaskActionInfo* taskActionInfo, IsosResourceTaskType type){
+void simulateCommonTaskWithResourceUsage(short taskId, IsosTaskActionInfo* taskActionInfo, IsosResourceTaskType type){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   //static int timeoutTrials; //may not be necessary
@@ -156,6 +179,8 @@ void simulateCommonTaskWithResourceUsage(unsigned char taskId, IsosTaskActionInf
       taskActionInfo->Subtask++;
     break;
   case 1:
+    if (Isos_WaitResourceTask(taskId, type)) //suspended, to be woken up in this subtask when the resource task completes
+      break;
     taskState = Isos_GetResourceTaskState(type);
     if (taskState == IsosTaskState_Success){
       Isos_ReleaseResourceTask(type);
@@ -185,7 +210,7 @@ void simulateCommonTaskWithResourceUsage(unsigned char taskId, IsosTaskActionInf
   }
 }
 
-void simulateCommonTaskWithMultiResourcesUsage(unsigned char taskId, IsosTaskActionInfo* taskActionInfo, IsosResourceTaskType type1, IsosResourceTaskType type2){
+void simulateCommonTaskWithMultiResourcesUsage(short taskId, IsosTaskActionInfo* taskActionInfo, IsosResourceTaskType type1, IsosResourceTaskType type2){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   //static int timeoutTrials; //may not be necessary
@@ -254,7 +279,7 @@ void simulateGettingRxData(IsosResourceTaskType type, int rxSize){
   short usedRxSize;
   unsigned char rxSimulatedDataBuffer[RX_DATA_BUFFER];
   buffer = Isos_GetResourceTaskBuffer(&result, type, 0); //by right result is always 1 for this simulation
-  if (buffer->DataSize <= 0){
+  if (IsosBuffer_GetDataSize(buffer) <= 0){
     usedRxSize = rxSize < 0 ? buffer->ExpectedDataSize : rxSize;
     for (int i = 0; i < usedRxSize; ++i)
       rxSimulatedDataBuffer[i] = rand();
@@ -262,32 +287,32 @@ void simulateGettingRxData(IsosResourceTaskType type, int rxSize){
   }
 }
 
-void NonCyclicalTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void NonCyclicalTask1(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type1);
 }
 
-void NonCyclicalTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void NonCyclicalTask2(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithMultiResourcesUsage(taskId, taskActionInfo, IsosResourceTaskType_Type1, IsosResourceTaskType_Type2);
 }
 
-void NonCyclicalTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void NonCyclicalTask3(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type2);
 }
 
-void LooselyRepeatedTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void LooselyRepeatedTask1(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type2);
 }
 
-void LooselyRepeatedTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void LooselyRepeatedTask2(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type1);
 }
 
-void LooselyRepeatedTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void LooselyRepeatedTask3(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithSuspension(taskId, taskActionInfo, 3, IsosTaskState_Success, 1, 0, 50);
 }
 
 //Task which calls resource task with Rx only buffer
-void LooselyRepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void LooselyRepeatedTask4(short taskId, IsosTaskActionInfo* taskActionInfo){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   IsosResourceTaskType type = IsosResourceTaskType_Type3;
@@ -324,7 +349,7 @@ void LooselyRepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionIn
 }
 
 //Task which calls resource task with Tx only buffer
-void LooselyRepeatedTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void LooselyRepeatedTask5(short taskId, IsosTaskActionInfo* taskActionInfo){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   IsosResourceTaskType type = IsosResourceTaskType_Type4;
@@ -363,15 +388,15 @@ void LooselyRepeatedTask5(unsigned char taskId, IsosTaskActionInfo* taskActionIn
   }
 }
 
-void RepeatedTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void RepeatedTask1(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTask(taskActionInfo, 5, IsosTaskState_Success);
 }
 
-void RepeatedTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void RepeatedTask2(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTask(taskActionInfo, 4, IsosTaskState_Failed);
 }
 
-void RepeatedTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void RepeatedTask3(short taskId, IsosTaskActionInfo* taskActionInfo){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   IsosResourceTaskType type = IsosResourceTaskType_Type5;
@@ -413,7 +438,7 @@ void RepeatedTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
   }
 }
 
-void RepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void RepeatedTask4(short taskId, IsosTaskActionInfo* taskActionInfo){
   char result = 0, isResource = 0;
   IsosTaskState taskState = IsosTaskState_Undefined;
   IsosResourceTaskType type = IsosResourceTaskType_Type6;
@@ -455,28 +480,28 @@ void RepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
   }
 }
 
-void RepeatedTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void RepeatedTask5(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type7);
 }
 
-void PeriodicTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask1(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type1);
 }
 
-void PeriodicTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask2(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type2);
 }
 
-void PeriodicTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask3(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithMultiResourcesUsage(taskId, taskActionInfo, IsosResourceTaskType_Type1, IsosResourceTaskType_Type2);
 }
 
-void PeriodicTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask4(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithMultiResourcesUsage(taskId, taskActionInfo, IsosResourceTaskType_Type2, IsosResourceTaskType_Type1);
 }
 
 //A stuck task
-void PeriodicTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask5(short taskId, IsosTaskActionInfo* taskActionInfo){
   char result = 0;
   IsosResourceTaskType type = IsosResourceTaskType_Type7;
   switch(taskActionInfo->Subtask){
@@ -491,21 +516,21 @@ void PeriodicTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
   }
 }
 
-void PeriodicTask6(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void PeriodicTask6(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithResourceUsage(taskId, taskActionInfo, IsosResourceTaskType_Type8);
 }
 
-void ResourceTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask1(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTask(taskActionInfo, 3, IsosTaskState_Success);
 }
 
 //Resource task with failure rate
-void ResourceTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask2(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTaskWithErrorRate(taskActionInfo, 3, 3);
 }
 
 //Resource with Rx only buffer (may not be needed)
-void ResourceTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask3(short taskId, IsosTaskActionInfo* taskActionInfo){
   static int runningNo = 0; //to simulate occasional retrieval of data from the Rx buffer
   int i;
   char result = 0, hasRx = 0;
@@ -531,7 +556,7 @@ void ResourceTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
 }
 
 //Resource task Tx only buffer
-void ResourceTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask4(short taskId, IsosTaskActionInfo* taskActionInfo){
   static int runningNo = 0; //to simulate if the sending has been completed
   char result = 0, txSent = 0, isResource = 1;
   short dataSize = 0;
@@ -563,7 +588,7 @@ void ResourceTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
 }
 
 //Resource task with Tx & Rx buffers waited by size
-void ResourceTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask5(short taskId, IsosTaskActionInfo* taskActionInfo){
   static int runningNo = 0; //to simulate if the sending has been completed
   char result = 0, txSent = 0, hasRx = 0, isResource = 1;
   short dataSize = 0;
@@ -608,7 +633,7 @@ void ResourceTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
 }
 
 //Resource task with Tx & Rx buffers waited by time
-void ResourceTask6(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask6(short taskId, IsosTaskActionInfo* taskActionInfo){
   static int runningNo = 0, shouldSuccess = 0; //to simulate if the sending has been completed. failed first, then success
   char result = 0, txSent = 0, isResource = 1;
   short dataSize = 0;
@@ -655,11 +680,11 @@ void ResourceTask6(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
   }
 }
 
-void ResourceTask7(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask7(short taskId, IsosTaskActionInfo* taskActionInfo){
   simulateCommonTask(taskActionInfo, 4, IsosTaskState_Success);
 }
 
-void ResourceTask8(unsigned char taskId, IsosTaskActionInfo* taskActionInfo){
+void ResourceTask8(short taskId, IsosTaskActionInfo* taskActionInfo){
   static int runningNo = 0;
   char timeToStuck = runningNo % 3 == 2;
   if (0 == taskActionInfo->Subtask)
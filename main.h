@@ -7,18 +7,18 @@
       -> Does not use stack pointers manipulation at all, so it is fully compatible with any code optimizers
       -> Very clear naming of the files, variables, and functions - leaving little rooms for guessing what they stand for
       -> No convoluted/fanciful-looking macros, code, etc, just pure, simple C
-      -> No deeply-nested/recursive code for everything (quick_sort algorithm excepted), making it very easy to read, even for beginner C coder
+      -> No deeply-nested/recursive code for everything, making it very easy to read, even for beginner C coder
       -> Uses (i) simple switch case and (ii) concept of subtask, instead of stack pointers manipulation to control segmentation of the tasks in a task function
   (2) Easy-to-use:
       -> One line code to initialize
       -> One line code to register each of the various type of tasks
       -> One line code to run the OS
          Note: See note (TODO) in the Isos_Run() function to implement
-      -> One file to configure the OS settings (Isos_task.h), with only six (6) macros to set
+      -> One file to configure the OS settings (Isos_task.h), with only a handful of macros to set
       -> Demonstrations/examples provided
   (3) Small-sized
-      -> The entire OS code is less than 1000 lines
-      -> Four (4) small C + header files only (+1 quick_sort and +1 debugging file-pairs)
+      -> The OS code is kept small, with one small C + header file-pair per concern
+      -> Each file-pair is described in its own file header
   (4) Fairly-comprehensive
       -> Sufficient for most of small-to-medium micro-controller OS development project requirements
       -> Capable of handling various type of tasks with different time-cycle/non-cycle requirements
@@ -47,30 +47,30 @@
 
 void registerTasks();
 
-void NonCyclicalTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void NonCyclicalTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void NonCyclicalTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test lower priority resource task claimer at T:370ms
-void LooselyRepeatedTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void LooselyRepeatedTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void LooselyRepeatedTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test task with suspension
-void LooselyRepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Rx only buffer
-void LooselyRepeatedTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx only buffer
-void RepeatedTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void RepeatedTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void RepeatedTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx & Rx buffers, called by size
-void RepeatedTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx & Rx buffers, called by time
-void RepeatedTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test competing task for the same resource with a stuck-task
-void PeriodicTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void PeriodicTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void PeriodicTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void PeriodicTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo);
-void PeriodicTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //test OS response for a stuck-task claiming a resource
-void PeriodicTask6(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //task which encounter occasional resource task's timeout
-void ResourceTask1(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //normal resource task
-void ResourceTask2(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with failure rate
-void ResourceTask3(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx only buffer
-void ResourceTask4(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Rx only buffer
-void ResourceTask5(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx & Rx buffers, called by size
-void ResourceTask6(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx & Rx buffers, called by time
-void ResourceTask7(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //normal resource task for a stuck task
-void ResourceTask8(unsigned char taskId, IsosTaskActionInfo* taskActionInfo); //resource task with occasional timeout
+void NonCyclicalTask1(short taskId, IsosTaskActionInfo* taskActionInfo);
+void NonCyclicalTask2(short taskId, IsosTaskActionInfo* taskActionInfo);
+void NonCyclicalTask3(short taskId, IsosTaskActionInfo* taskActionInfo); //test lower priority resource task claimer at T:370ms
+void LooselyRepeatedTask1(short taskId, IsosTaskActionInfo* taskActionInfo);
+void LooselyRepeatedTask2(short taskId, IsosTaskActionInfo* taskActionInfo);
+void LooselyRepeatedTask3(short taskId, IsosTaskActionInfo* taskActionInfo); //test task with suspension
+void LooselyRepeatedTask4(short taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Rx only buffer
+void LooselyRepeatedTask5(short taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx only buffer
+void RepeatedTask1(short taskId, IsosTaskActionInfo* taskActionInfo);
+void RepeatedTask2(short taskId, IsosTaskActionInfo* taskActionInfo);
+void RepeatedTask3(short taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx & Rx buffers, called by size
+void RepeatedTask4(short taskId, IsosTaskActionInfo* taskActionInfo); //test resource task with Tx & Rx buffers, called by time
+void RepeatedTask5(short taskId, IsosTaskActionInfo* taskActionInfo); //test competing task for the same resource with a stuck-task
+void PeriodicTask1(short taskId, IsosTaskActionInfo* taskActionInfo);
+void PeriodicTask2(short taskId, IsosTaskActionInfo* taskActionInfo);
+void PeriodicTask3(short taskId, IsosTaskActionInfo* taskActionInfo);
+void PeriodicTask4(short taskId, IsosTaskActionInfo* taskActionInfo);
+void PeriodicTask5(short taskId, IsosTaskActionInfo* taskActionInfo); //test OS response for a stuck-task claiming a resource
+void PeriodicTask6(short taskId, IsosTaskActionInfo* taskActionInfo); //task which encounter occasional resource task's timeout
+void ResourceTask1(short taskId, IsosTaskActionInfo* taskActionInfo); //normal resource task
+void ResourceTask2(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with failure rate
+void ResourceTask3(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx only buffer
+void ResourceTask4(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Rx only buffer
+void ResourceTask5(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx & Rx buffers, called by size
+void ResourceTask6(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with Tx & Rx buffers, called by time
+void ResourceTask7(short taskId, IsosTaskActionInfo* taskActionInfo); //normal resource task for a stuck task
+void ResourceTask8(short taskId, IsosTaskActionInfo* taskActionInfo); //resource task with occasional timeout